@@ -0,0 +1,617 @@
+#include "MT25041_Part_Common.h"
+#include "MT25041_Part_Ring.h"
+
+#include <signal.h>
+#include <sys/epoll.h>
+
+#define EVENT_LOOP_MAX_EVENTS 64
+#define EVENT_LOOP_RECEIVES_PER_WAKEUP 16
+#define EVENT_LOOP_WAIT_MILLISECONDS 100
+
+typedef struct receive_buffer_node
+{
+    struct receive_buffer_node *next_buffer;
+} receive_buffer_node_t;
+
+typedef struct
+{
+    receive_buffer_node_t *free_buffer_list;
+    size_t buffer_size;
+    uint64_t borrow_count;
+    uint64_t reuse_hit_count;
+    uint64_t allocated_buffer_count;
+    uint64_t outstanding_buffer_count;
+    uint64_t peak_outstanding_buffer_count;
+} receive_buffer_pool_t;
+
+typedef struct pooled_connection
+{
+    int socket_file_descriptor;
+    char *borrowed_buffer;
+    size_t bytes_received;
+    size_t echo_bytes_sent;
+    int echo_pending;
+    uint64_t message_received_time_ns;
+    struct pooled_connection *previous_connection;
+    struct pooled_connection *next_connection;
+} pooled_connection_t;
+
+typedef struct
+{
+    _Alignas(CACHE_LINE_SIZE) int loop_index;
+    int epoll_file_descriptor;
+    pthread_t loop_thread;
+    const server_config_t *server_config;
+    atomic_int *accept_finished_ptr;
+    atomic_int open_connection_count;
+    int listen_socket_fd;
+    pooled_connection_t *connection_list_head;
+    uint64_t accepted_connection_count;
+    uint64_t accept_wakeup_count;
+    receive_buffer_pool_t buffer_pool;
+    server_work_scratch_t work_scratch;
+    latency_histogram_t service_histogram;
+    uint64_t message_count;
+} event_loop_t;
+
+static char *receive_buffer_pool_borrow(receive_buffer_pool_t *buffer_pool_ptr)
+{
+    buffer_pool_ptr->borrow_count++;
+    char *buffer_pointer = NULL;
+    if (buffer_pool_ptr->free_buffer_list)
+    {
+        receive_buffer_node_t *buffer_node_ptr = buffer_pool_ptr->free_buffer_list;
+        buffer_pool_ptr->free_buffer_list = buffer_node_ptr->next_buffer;
+        buffer_pool_ptr->reuse_hit_count++;
+        buffer_pointer = (char *)buffer_node_ptr;
+    }
+    else
+    {
+        size_t allocation_size = buffer_pool_ptr->buffer_size > sizeof(receive_buffer_node_t) ? buffer_pool_ptr->buffer_size : sizeof(receive_buffer_node_t);
+        buffer_pointer = (char *)aligned_alloc(CACHE_LINE_SIZE, (allocation_size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE);
+        if (!buffer_pointer)
+        {
+            return NULL;
+        }
+        buffer_pool_ptr->allocated_buffer_count++;
+    }
+    buffer_pool_ptr->outstanding_buffer_count++;
+    if (buffer_pool_ptr->outstanding_buffer_count > buffer_pool_ptr->peak_outstanding_buffer_count)
+    {
+        buffer_pool_ptr->peak_outstanding_buffer_count = buffer_pool_ptr->outstanding_buffer_count;
+    }
+    return buffer_pointer;
+}
+
+static void receive_buffer_pool_release(receive_buffer_pool_t *buffer_pool_ptr, char *buffer_pointer)
+{
+    receive_buffer_node_t *buffer_node_ptr = (receive_buffer_node_t *)buffer_pointer;
+    buffer_node_ptr->next_buffer = buffer_pool_ptr->free_buffer_list;
+    buffer_pool_ptr->free_buffer_list = buffer_node_ptr;
+    buffer_pool_ptr->outstanding_buffer_count--;
+}
+
+static void receive_buffer_pool_destroy(receive_buffer_pool_t *buffer_pool_ptr)
+{
+    while (buffer_pool_ptr->free_buffer_list)
+    {
+        receive_buffer_node_t *buffer_node_ptr = buffer_pool_ptr->free_buffer_list;
+        buffer_pool_ptr->free_buffer_list = buffer_node_ptr->next_buffer;
+        free(buffer_node_ptr);
+    }
+}
+
+static void event_loop_close_connection(event_loop_t *event_loop_ptr, pooled_connection_t *connection_ptr)
+{
+    epoll_ctl(event_loop_ptr->epoll_file_descriptor, EPOLL_CTL_DEL, connection_ptr->socket_file_descriptor, NULL);
+    close(connection_ptr->socket_file_descriptor);
+    if (connection_ptr->previous_connection)
+    {
+        connection_ptr->previous_connection->next_connection = connection_ptr->next_connection;
+    }
+    else if (event_loop_ptr->connection_list_head == connection_ptr)
+    {
+        event_loop_ptr->connection_list_head = connection_ptr->next_connection;
+    }
+    if (connection_ptr->next_connection)
+    {
+        connection_ptr->next_connection->previous_connection = connection_ptr->previous_connection;
+    }
+    if (connection_ptr->borrowed_buffer)
+    {
+        receive_buffer_pool_release(&event_loop_ptr->buffer_pool, connection_ptr->borrowed_buffer);
+    }
+    free(connection_ptr);
+    atomic_fetch_sub_explicit(&event_loop_ptr->open_connection_count, 1, memory_order_release);
+}
+
+static void event_loop_set_interest(event_loop_t *event_loop_ptr, pooled_connection_t *connection_ptr, uint32_t interest_events)
+{
+    struct epoll_event interest_event;
+    interest_event.events = interest_events;
+    interest_event.data.ptr = connection_ptr;
+    epoll_ctl(event_loop_ptr->epoll_file_descriptor, EPOLL_CTL_MOD, connection_ptr->socket_file_descriptor, &interest_event);
+}
+
+static void event_loop_finish_message(event_loop_t *event_loop_ptr, pooled_connection_t *connection_ptr)
+{
+    const server_config_t *server_config = event_loop_ptr->server_config;
+    event_loop_ptr->message_count++;
+    connection_ptr->bytes_received = 0;
+    if (server_config->work_kind != WORK_NONE)
+    {
+        server_work_execute(server_config, &event_loop_ptr->work_scratch, connection_ptr->borrowed_buffer, server_config->message_size);
+        latency_histogram_record(&event_loop_ptr->service_histogram, now_ns() - connection_ptr->message_received_time_ns);
+    }
+    if (server_config->enable_echo)
+    {
+        connection_ptr->echo_pending = 1;
+        connection_ptr->echo_bytes_sent = 0;
+    }
+}
+
+static int event_loop_flush_echo(event_loop_t *event_loop_ptr, pooled_connection_t *connection_ptr)
+{
+    size_t message_size = event_loop_ptr->server_config->message_size;
+    while (connection_ptr->echo_bytes_sent < message_size)
+    {
+        ssize_t send_result = send(connection_ptr->socket_file_descriptor,
+                                   connection_ptr->borrowed_buffer + connection_ptr->echo_bytes_sent,
+                                   message_size - connection_ptr->echo_bytes_sent,
+                                   MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (send_result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return 0;
+            }
+            return -1;
+        }
+        connection_ptr->echo_bytes_sent += (size_t)send_result;
+    }
+    connection_ptr->echo_pending = 0;
+    return 1;
+}
+
+static int event_loop_service_connection(event_loop_t *event_loop_ptr, pooled_connection_t *connection_ptr)
+{
+    size_t message_size = event_loop_ptr->server_config->message_size;
+
+    if (connection_ptr->echo_pending)
+    {
+        int flush_result = event_loop_flush_echo(event_loop_ptr, connection_ptr);
+        if (flush_result < 0)
+        {
+            return -1;
+        }
+        if (flush_result == 0)
+        {
+            return 0;
+        }
+        event_loop_set_interest(event_loop_ptr, connection_ptr, EPOLLIN);
+    }
+
+    for (int receive_index = 0; receive_index < EVENT_LOOP_RECEIVES_PER_WAKEUP; receive_index++)
+    {
+        if (!connection_ptr->borrowed_buffer)
+        {
+            connection_ptr->borrowed_buffer = receive_buffer_pool_borrow(&event_loop_ptr->buffer_pool);
+            if (!connection_ptr->borrowed_buffer)
+            {
+                return -1;
+            }
+        }
+        ssize_t receive_result = recv(connection_ptr->socket_file_descriptor,
+                                      connection_ptr->borrowed_buffer + connection_ptr->bytes_received,
+                                      message_size - connection_ptr->bytes_received,
+                                      MSG_DONTWAIT);
+        if (receive_result == 0)
+        {
+            return -1;
+        }
+        if (receive_result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            return -1;
+        }
+        connection_ptr->bytes_received += (size_t)receive_result;
+        if (connection_ptr->bytes_received < message_size)
+        {
+            continue;
+        }
+
+        connection_ptr->message_received_time_ns = now_ns();
+        event_loop_finish_message(event_loop_ptr, connection_ptr);
+        if (connection_ptr->echo_pending)
+        {
+            int flush_result = event_loop_flush_echo(event_loop_ptr, connection_ptr);
+            if (flush_result < 0)
+            {
+                return -1;
+            }
+            if (flush_result == 0)
+            {
+                event_loop_set_interest(event_loop_ptr, connection_ptr, EPOLLOUT);
+                return 0;
+            }
+        }
+    }
+
+    if (connection_ptr->bytes_received == 0 && !connection_ptr->echo_pending && connection_ptr->borrowed_buffer)
+    {
+        receive_buffer_pool_release(&event_loop_ptr->buffer_pool, connection_ptr->borrowed_buffer);
+        connection_ptr->borrowed_buffer = NULL;
+    }
+    return 0;
+}
+
+static void event_loop_accept_connections(event_loop_t *event_loop_ptr)
+{
+    event_loop_ptr->accept_wakeup_count++;
+    for (int accept_index = 0; accept_index < event_loop_ptr->server_config->accept_batch_size; accept_index++)
+    {
+        int accepted_socket_fd = accept4(event_loop_ptr->listen_socket_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (accepted_socket_fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            break;
+        }
+        pooled_connection_t *connection_ptr = (pooled_connection_t *)calloc(1, sizeof(pooled_connection_t));
+        if (!connection_ptr)
+        {
+            close(accepted_socket_fd);
+            break;
+        }
+        connection_ptr->socket_file_descriptor = accepted_socket_fd;
+        struct epoll_event interest_event;
+        interest_event.events = EPOLLIN;
+        interest_event.data.ptr = connection_ptr;
+        if (epoll_ctl(event_loop_ptr->epoll_file_descriptor, EPOLL_CTL_ADD, accepted_socket_fd, &interest_event) != 0)
+        {
+            close(accepted_socket_fd);
+            free(connection_ptr);
+            continue;
+        }
+        connection_ptr->next_connection = event_loop_ptr->connection_list_head;
+        if (event_loop_ptr->connection_list_head)
+        {
+            event_loop_ptr->connection_list_head->previous_connection = connection_ptr;
+        }
+        event_loop_ptr->connection_list_head = connection_ptr;
+        event_loop_ptr->accepted_connection_count++;
+        atomic_fetch_add_explicit(&event_loop_ptr->open_connection_count, 1, memory_order_relaxed);
+    }
+}
+
+static void *event_loop_main(void *thread_argument)
+{
+    event_loop_t *event_loop_ptr = (event_loop_t *)thread_argument;
+    const server_config_t *server_config = event_loop_ptr->server_config;
+    struct epoll_event ready_events[EVENT_LOOP_MAX_EVENTS];
+
+    if (server_config->cpu_pin_base >= 0)
+    {
+        pin_thread(server_config->cpu_pin_base + event_loop_ptr->loop_index);
+    }
+
+    while (1)
+    {
+        if (atomic_load_explicit(event_loop_ptr->accept_finished_ptr, memory_order_acquire) &&
+            (event_loop_ptr->listen_socket_fd >= 0 ||
+             atomic_load_explicit(&event_loop_ptr->open_connection_count, memory_order_acquire) == 0))
+        {
+            break;
+        }
+        int ready_event_count = epoll_wait(event_loop_ptr->epoll_file_descriptor, ready_events, EVENT_LOOP_MAX_EVENTS, EVENT_LOOP_WAIT_MILLISECONDS);
+        if (ready_event_count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        for (int event_index = 0; event_index < ready_event_count; event_index++)
+        {
+            pooled_connection_t *connection_ptr = (pooled_connection_t *)ready_events[event_index].data.ptr;
+            if (!connection_ptr)
+            {
+                event_loop_accept_connections(event_loop_ptr);
+                continue;
+            }
+            if (event_loop_service_connection(event_loop_ptr, connection_ptr) < 0)
+            {
+                event_loop_close_connection(event_loop_ptr, connection_ptr);
+            }
+        }
+    }
+    while (event_loop_ptr->connection_list_head)
+    {
+        event_loop_close_connection(event_loop_ptr, event_loop_ptr->connection_list_head);
+    }
+    return NULL;
+}
+
+static event_loop_t *event_loops_create(const server_config_t *server_config, int event_loop_count, atomic_int *accept_finished_ptr)
+{
+    event_loop_t *event_loop_array = (event_loop_t *)aligned_alloc(CACHE_LINE_SIZE, sizeof(event_loop_t) * (size_t)event_loop_count);
+    if (!event_loop_array)
+    {
+        return NULL;
+    }
+    memset(event_loop_array, 0, sizeof(event_loop_t) * (size_t)event_loop_count);
+
+    for (int loop_index = 0; loop_index < event_loop_count; loop_index++)
+    {
+        event_loop_t *event_loop_ptr = &event_loop_array[loop_index];
+        event_loop_ptr->loop_index = loop_index;
+        event_loop_ptr->server_config = server_config;
+        event_loop_ptr->accept_finished_ptr = accept_finished_ptr;
+        event_loop_ptr->listen_socket_fd = -1;
+        event_loop_ptr->buffer_pool.buffer_size = server_config->message_size;
+        atomic_init(&event_loop_ptr->open_connection_count, 0);
+        event_loop_ptr->epoll_file_descriptor = epoll_create1(EPOLL_CLOEXEC);
+        if (event_loop_ptr->epoll_file_descriptor < 0 || server_work_scratch_init(&event_loop_ptr->work_scratch, server_config) != 0)
+        {
+            perror("epoll_create1");
+            return NULL;
+        }
+    }
+    return event_loop_array;
+}
+
+static void event_loops_join_and_report(event_loop_t *event_loop_array, int event_loop_count, const server_config_t *server_config)
+{
+    uint64_t borrow_count_total = 0;
+    uint64_t reuse_hit_count_total = 0;
+    uint64_t allocated_buffer_count_total = 0;
+    uint64_t peak_outstanding_buffer_total = 0;
+    uint64_t message_count_total = 0;
+    latency_histogram_t *aggregated_service_histogram = (latency_histogram_t *)calloc(1, sizeof(latency_histogram_t));
+
+    for (int loop_index = 0; loop_index < event_loop_count; loop_index++)
+    {
+        event_loop_t *event_loop_ptr = &event_loop_array[loop_index];
+        pthread_join(event_loop_ptr->loop_thread, NULL);
+        borrow_count_total += event_loop_ptr->buffer_pool.borrow_count;
+        reuse_hit_count_total += event_loop_ptr->buffer_pool.reuse_hit_count;
+        allocated_buffer_count_total += event_loop_ptr->buffer_pool.allocated_buffer_count;
+        peak_outstanding_buffer_total += event_loop_ptr->buffer_pool.peak_outstanding_buffer_count;
+        message_count_total += event_loop_ptr->message_count;
+        if (aggregated_service_histogram)
+        {
+            latency_histogram_merge(aggregated_service_histogram, &event_loop_ptr->service_histogram);
+        }
+    }
+
+    printf("SERVER_BUFFER_POOL,%d,%llu,%llu,%llu,%llu,%.4f\n",
+           event_loop_count,
+           (unsigned long long)message_count_total,
+           (unsigned long long)borrow_count_total,
+           (unsigned long long)allocated_buffer_count_total,
+           (unsigned long long)peak_outstanding_buffer_total,
+           borrow_count_total ? (double)reuse_hit_count_total / (double)borrow_count_total : 0.0);
+    if (server_config->work_kind != WORK_NONE && aggregated_service_histogram)
+    {
+        char service_line_prefix[96];
+        snprintf(service_line_prefix, sizeof(service_line_prefix), "SERVER_WORK,%s,inline,%llu",
+                 server_work_kind_name(server_config->work_kind),
+                 (unsigned long long)aggregated_service_histogram->total_count);
+        report_latency_percentiles(service_line_prefix, aggregated_service_histogram);
+    }
+    free(aggregated_service_histogram);
+}
+
+static void event_loops_destroy(event_loop_t *event_loop_array, int event_loop_count)
+{
+    for (int loop_index = 0; loop_index < event_loop_count; loop_index++)
+    {
+        close(event_loop_array[loop_index].epoll_file_descriptor);
+        receive_buffer_pool_destroy(&event_loop_array[loop_index].buffer_pool);
+        server_work_scratch_free(&event_loop_array[loop_index].work_scratch);
+    }
+    free(event_loop_array);
+}
+
+int run_buffer_pool_server(const server_config_t *server_config, int listen_socket_fd)
+{
+    int event_loop_count = server_config->io_thread_count;
+    if (event_loop_count < 1)
+    {
+        event_loop_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (event_loop_count > server_config->maximum_clients)
+    {
+        event_loop_count = server_config->maximum_clients;
+    }
+    if (event_loop_count < 1)
+    {
+        event_loop_count = 1;
+    }
+
+    atomic_int accept_finished;
+    atomic_init(&accept_finished, 0);
+    long baseline_resident_kilobytes = read_process_memory_kilobytes("VmRSS:");
+    event_loop_t *event_loop_array = event_loops_create(server_config, event_loop_count, &accept_finished);
+    if (!event_loop_array)
+    {
+        return 1;
+    }
+    for (int loop_index = 0; loop_index < event_loop_count; loop_index++)
+    {
+        pthread_create(&event_loop_array[loop_index].loop_thread, NULL, event_loop_main, &event_loop_array[loop_index]);
+    }
+
+    int accepted_connections_count = 0;
+    while (accepted_connections_count < server_config->maximum_clients)
+    {
+        int accepted_socket_fd = accept4(listen_socket_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (accepted_socket_fd < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        pooled_connection_t *connection_ptr = (pooled_connection_t *)calloc(1, sizeof(pooled_connection_t));
+        if (!connection_ptr)
+        {
+            close(accepted_socket_fd);
+            break;
+        }
+        connection_ptr->socket_file_descriptor = accepted_socket_fd;
+        event_loop_t *event_loop_ptr = &event_loop_array[accepted_connections_count % event_loop_count];
+        atomic_fetch_add_explicit(&event_loop_ptr->open_connection_count, 1, memory_order_acq_rel);
+        struct epoll_event interest_event;
+        interest_event.events = EPOLLIN;
+        interest_event.data.ptr = connection_ptr;
+        if (epoll_ctl(event_loop_ptr->epoll_file_descriptor, EPOLL_CTL_ADD, accepted_socket_fd, &interest_event) != 0)
+        {
+            atomic_fetch_sub_explicit(&event_loop_ptr->open_connection_count, 1, memory_order_acq_rel);
+            close(accepted_socket_fd);
+            free(connection_ptr);
+            continue;
+        }
+        accepted_connections_count++;
+    }
+    atomic_store_explicit(&accept_finished, 1, memory_order_release);
+    close(listen_socket_fd);
+
+    event_loops_join_and_report(event_loop_array, event_loop_count, server_config);
+    report_server_memory("pool", accepted_connections_count, baseline_resident_kilobytes);
+    event_loops_destroy(event_loop_array, event_loop_count);
+    return 0;
+}
+
+int run_churn_server(const server_config_t *server_config)
+{
+    int event_loop_count = server_config->io_thread_count;
+    if (event_loop_count < 1)
+    {
+        event_loop_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (event_loop_count < 1)
+    {
+        event_loop_count = 1;
+    }
+
+    int listen_options = LISTEN_OPTION_NONBLOCK;
+    if (server_config->reuseport_enabled)
+    {
+        listen_options |= LISTEN_OPTION_REUSEPORT;
+    }
+    if (server_config->fastopen_enabled)
+    {
+        listen_options |= LISTEN_OPTION_FASTOPEN;
+    }
+
+    atomic_int accept_finished;
+    atomic_init(&accept_finished, 0);
+    event_loop_t *event_loop_array = event_loops_create(server_config, event_loop_count, &accept_finished);
+    int *listen_socket_array = (int *)malloc(sizeof(int) * (size_t)event_loop_count);
+    if (!event_loop_array || !listen_socket_array)
+    {
+        free(listen_socket_array);
+        return 1;
+    }
+
+    int listen_socket_count = server_config->reuseport_enabled ? event_loop_count : 1;
+    for (int listen_index = 0; listen_index < listen_socket_count; listen_index++)
+    {
+        listen_socket_array[listen_index] = create_server_socket(server_config->bind_ip_address, server_config->port_number, listen_options);
+        if (listen_socket_array[listen_index] < 0)
+        {
+            perror("listen");
+            return 1;
+        }
+    }
+    for (int loop_index = 0; loop_index < event_loop_count; loop_index++)
+    {
+        event_loop_t *event_loop_ptr = &event_loop_array[loop_index];
+        event_loop_ptr->listen_socket_fd = listen_socket_array[server_config->reuseport_enabled ? loop_index : 0];
+        struct epoll_event interest_event;
+        interest_event.events = server_config->reuseport_enabled ? EPOLLIN : (EPOLLIN | EPOLLEXCLUSIVE);
+        interest_event.data.ptr = NULL;
+        if (epoll_ctl(event_loop_ptr->epoll_file_descriptor, EPOLL_CTL_ADD, event_loop_ptr->listen_socket_fd, &interest_event) != 0)
+        {
+            perror("epoll_ctl");
+            return 1;
+        }
+    }
+
+    sigset_t stop_signal_set;
+    sigemptyset(&stop_signal_set);
+    sigaddset(&stop_signal_set, SIGINT);
+    sigaddset(&stop_signal_set, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signal_set, NULL);
+
+    uint64_t churn_start_time_ns = now_ns();
+    for (int loop_index = 0; loop_index < event_loop_count; loop_index++)
+    {
+        pthread_create(&event_loop_array[loop_index].loop_thread, NULL, event_loop_main, &event_loop_array[loop_index]);
+    }
+
+    if (server_config->duration_seconds > 0)
+    {
+        struct timespec churn_duration = {server_config->duration_seconds, 0};
+        while (sigtimedwait(&stop_signal_set, NULL, &churn_duration) < 0 && errno == EINTR)
+        {
+            uint64_t elapsed_nanoseconds = now_ns() - churn_start_time_ns;
+            uint64_t duration_nanoseconds = (uint64_t)server_config->duration_seconds * 1000000000ULL;
+            if (elapsed_nanoseconds >= duration_nanoseconds)
+            {
+                break;
+            }
+            churn_duration.tv_sec = (time_t)((duration_nanoseconds - elapsed_nanoseconds) / 1000000000ULL);
+            churn_duration.tv_nsec = (long)((duration_nanoseconds - elapsed_nanoseconds) % 1000000000ULL);
+        }
+    }
+    else
+    {
+        int received_signal = 0;
+        sigwait(&stop_signal_set, &received_signal);
+    }
+    uint64_t churn_elapsed_ns = now_ns() - churn_start_time_ns;
+    atomic_store_explicit(&accept_finished, 1, memory_order_release);
+
+    event_loops_join_and_report(event_loop_array, event_loop_count, server_config);
+    uint64_t accepted_connection_total = 0;
+    uint64_t accept_wakeup_total = 0;
+    for (int loop_index = 0; loop_index < event_loop_count; loop_index++)
+    {
+        accepted_connection_total += event_loop_array[loop_index].accepted_connection_count;
+        accept_wakeup_total += event_loop_array[loop_index].accept_wakeup_count;
+    }
+    double churn_elapsed_seconds = (double)churn_elapsed_ns / 1e9;
+    printf("SERVER_CHURN,%d,%s,%d,%llu,%.6f,%.1f,%.2f\n",
+           event_loop_count,
+           server_config->reuseport_enabled ? "reuseport" : "shared",
+           server_config->accept_batch_size,
+           (unsigned long long)accepted_connection_total,
+           churn_elapsed_seconds,
+           churn_elapsed_seconds > 0.0 ? (double)accepted_connection_total / churn_elapsed_seconds : 0.0,
+           accept_wakeup_total ? (double)accepted_connection_total / (double)accept_wakeup_total : 0.0);
+
+    for (int listen_index = 0; listen_index < listen_socket_count; listen_index++)
+    {
+        close(listen_socket_array[listen_index]);
+    }
+    free(listen_socket_array);
+    event_loops_destroy(event_loop_array, event_loop_count);
+    return 0;
+}
@@ -0,0 +1,490 @@
+#include "MT25041_Part_Transport.h"
+
+#include <stdatomic.h>
+#include <sys/syscall.h>
+
+#define CALIBRATE_MAX_SIZES 32
+#define CALIBRATE_MAX_STREAM_COUNTS 16
+#define CALIBRATE_CLOCK_CHECK_INTERVAL 256
+
+typedef struct
+{
+    size_t message_sizes[CALIBRATE_MAX_SIZES];
+    int message_size_count;
+    int stream_counts[CALIBRATE_MAX_STREAM_COUNTS];
+    int stream_count_count;
+    int all_core_threads;
+    uint64_t duration_nanoseconds;
+} calibrate_config_t;
+
+typedef struct
+{
+    int thread_index;
+    size_t message_size;
+    uint64_t duration_nanoseconds;
+    int socket_file_descriptor;
+    atomic_int *start_flag_ptr;
+    uint64_t transferred_bytes;
+    uint64_t elapsed_nanoseconds;
+} calibrate_worker_t;
+
+typedef struct
+{
+    _Alignas(64) atomic_uint_fast64_t shared_sequence;
+    int cpu_core_ids[2];
+    int share_one_core;
+} cacheline_pingpong_t;
+
+static void report_ceiling(const char *benchmark_name, size_t message_size, int thread_count, double ceiling_value, const char *unit_name)
+{
+    printf("CEILING,%s,%zu,%d,%.6f,%s\n", benchmark_name, message_size, thread_count, ceiling_value, unit_name);
+    fflush(stdout);
+}
+
+static void pin_calibration_thread(int thread_index)
+{
+    int online_cpu_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    pin_thread(online_cpu_count > 0 ? thread_index % online_cpu_count : 0);
+}
+
+static void wait_for_start(atomic_int *start_flag_ptr)
+{
+    while (!atomic_load_explicit(start_flag_ptr, memory_order_acquire))
+    {
+        sched_yield();
+    }
+}
+
+static void *memcpy_worker_main(void *thread_argument)
+{
+    calibrate_worker_t *worker_ptr = (calibrate_worker_t *)thread_argument;
+    pin_calibration_thread(worker_ptr->thread_index);
+    char *source_buffer = (char *)aligned_alloc(64, (worker_ptr->message_size + 63) / 64 * 64);
+    char *destination_buffer = (char *)aligned_alloc(64, (worker_ptr->message_size + 63) / 64 * 64);
+    if (!source_buffer || !destination_buffer)
+    {
+        free(source_buffer);
+        free(destination_buffer);
+        return NULL;
+    }
+    memset(source_buffer, 0x5a, worker_ptr->message_size);
+    memset(destination_buffer, 0, worker_ptr->message_size);
+
+    wait_for_start(worker_ptr->start_flag_ptr);
+    uint64_t copy_count = 0;
+    uint64_t start_time_ns = now_ns();
+    uint64_t elapsed_nanoseconds = 0;
+    while (elapsed_nanoseconds < worker_ptr->duration_nanoseconds)
+    {
+        for (int copy_index = 0; copy_index < CALIBRATE_CLOCK_CHECK_INTERVAL; copy_index++)
+        {
+            memcpy(destination_buffer, source_buffer, worker_ptr->message_size);
+            __asm__ volatile("" : : "r"(destination_buffer) : "memory");
+        }
+        copy_count += CALIBRATE_CLOCK_CHECK_INTERVAL;
+        elapsed_nanoseconds = now_ns() - start_time_ns;
+    }
+    worker_ptr->transferred_bytes = copy_count * worker_ptr->message_size;
+    worker_ptr->elapsed_nanoseconds = elapsed_nanoseconds;
+    free(source_buffer);
+    free(destination_buffer);
+    return NULL;
+}
+
+static double run_memcpy_bandwidth(size_t message_size, int thread_count, uint64_t duration_nanoseconds)
+{
+    pthread_t *thread_array = (pthread_t *)calloc((size_t)thread_count, sizeof(pthread_t));
+    calibrate_worker_t *worker_array = (calibrate_worker_t *)calloc((size_t)thread_count, sizeof(calibrate_worker_t));
+    if (!thread_array || !worker_array)
+    {
+        free(thread_array);
+        free(worker_array);
+        return 0.0;
+    }
+    atomic_int start_flag;
+    atomic_init(&start_flag, 0);
+    for (int thread_index = 0; thread_index < thread_count; thread_index++)
+    {
+        worker_array[thread_index].thread_index = thread_index;
+        worker_array[thread_index].message_size = message_size;
+        worker_array[thread_index].duration_nanoseconds = duration_nanoseconds;
+        worker_array[thread_index].start_flag_ptr = &start_flag;
+        pthread_create(&thread_array[thread_index], NULL, memcpy_worker_main, &worker_array[thread_index]);
+    }
+    atomic_store_explicit(&start_flag, 1, memory_order_release);
+
+    double aggregate_gbps = 0.0;
+    for (int thread_index = 0; thread_index < thread_count; thread_index++)
+    {
+        pthread_join(thread_array[thread_index], NULL);
+        if (worker_array[thread_index].elapsed_nanoseconds > 0)
+        {
+            aggregate_gbps += (double)worker_array[thread_index].transferred_bytes * 8.0 / (double)worker_array[thread_index].elapsed_nanoseconds;
+        }
+    }
+    free(thread_array);
+    free(worker_array);
+    return aggregate_gbps;
+}
+
+static double run_null_syscall(uint64_t duration_nanoseconds)
+{
+    uint64_t syscall_count = 0;
+    uint64_t start_time_ns = now_ns();
+    uint64_t elapsed_nanoseconds = 0;
+    while (elapsed_nanoseconds < duration_nanoseconds)
+    {
+        for (int call_index = 0; call_index < CALIBRATE_CLOCK_CHECK_INTERVAL; call_index++)
+        {
+            syscall(SYS_getppid);
+        }
+        syscall_count += CALIBRATE_CLOCK_CHECK_INTERVAL;
+        elapsed_nanoseconds = now_ns() - start_time_ns;
+    }
+    return (double)elapsed_nanoseconds / (double)syscall_count;
+}
+
+static void *socketpair_echo_main(void *thread_argument)
+{
+    calibrate_worker_t *worker_ptr = (calibrate_worker_t *)thread_argument;
+    pin_calibration_thread(worker_ptr->thread_index);
+    char *echo_buffer = (char *)malloc(worker_ptr->message_size);
+    if (!echo_buffer)
+    {
+        return NULL;
+    }
+    while (read_full(worker_ptr->socket_file_descriptor, echo_buffer, worker_ptr->message_size) > 0)
+    {
+        if (write_full(worker_ptr->socket_file_descriptor, echo_buffer, worker_ptr->message_size) <= 0)
+        {
+            break;
+        }
+    }
+    free(echo_buffer);
+    return NULL;
+}
+
+static double run_socketpair_pingpong(size_t message_size, uint64_t duration_nanoseconds)
+{
+    int socket_pair[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, socket_pair) != 0)
+    {
+        return 0.0;
+    }
+    calibrate_worker_t echo_worker;
+    memset(&echo_worker, 0, sizeof(echo_worker));
+    echo_worker.thread_index = 1;
+    echo_worker.message_size = message_size;
+    echo_worker.socket_file_descriptor = socket_pair[1];
+    pthread_t echo_thread;
+    pthread_create(&echo_thread, NULL, socketpair_echo_main, &echo_worker);
+    pin_thread(0);
+
+    char *ping_buffer = (char *)calloc(1, message_size);
+    uint64_t round_trip_count = 0;
+    uint64_t start_time_ns = now_ns();
+    uint64_t elapsed_nanoseconds = 0;
+    while (ping_buffer && elapsed_nanoseconds < duration_nanoseconds)
+    {
+        if (write_full(socket_pair[0], ping_buffer, message_size) <= 0 ||
+            read_full(socket_pair[0], ping_buffer, message_size) <= 0)
+        {
+            break;
+        }
+        round_trip_count++;
+        elapsed_nanoseconds = now_ns() - start_time_ns;
+    }
+    shutdown(socket_pair[0], SHUT_RDWR);
+    pthread_join(echo_thread, NULL);
+    close(socket_pair[0]);
+    close(socket_pair[1]);
+    free(ping_buffer);
+    return round_trip_count ? (double)elapsed_nanoseconds / (double)round_trip_count / 1000.0 : 0.0;
+}
+
+static void *loopback_sender_main(void *thread_argument)
+{
+    calibrate_worker_t *worker_ptr = (calibrate_worker_t *)thread_argument;
+    pin_calibration_thread(worker_ptr->thread_index);
+    char *send_buffer = (char *)calloc(1, worker_ptr->message_size);
+    if (!send_buffer)
+    {
+        shutdown(worker_ptr->socket_file_descriptor, SHUT_WR);
+        return NULL;
+    }
+    wait_for_start(worker_ptr->start_flag_ptr);
+    uint64_t start_time_ns = now_ns();
+    while (now_ns() - start_time_ns < worker_ptr->duration_nanoseconds)
+    {
+        if (write_full(worker_ptr->socket_file_descriptor, send_buffer, worker_ptr->message_size) <= 0)
+        {
+            break;
+        }
+    }
+    shutdown(worker_ptr->socket_file_descriptor, SHUT_WR);
+    free(send_buffer);
+    return NULL;
+}
+
+static void *loopback_receiver_main(void *thread_argument)
+{
+    calibrate_worker_t *worker_ptr = (calibrate_worker_t *)thread_argument;
+    pin_calibration_thread(worker_ptr->thread_index);
+    char *receive_buffer = (char *)malloc(worker_ptr->message_size);
+    if (!receive_buffer)
+    {
+        return NULL;
+    }
+    wait_for_start(worker_ptr->start_flag_ptr);
+    uint64_t start_time_ns = now_ns();
+    while (1)
+    {
+        ssize_t receive_result = recv(worker_ptr->socket_file_descriptor, receive_buffer, worker_ptr->message_size, 0);
+        if (receive_result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (receive_result <= 0)
+        {
+            break;
+        }
+        worker_ptr->transferred_bytes += (uint64_t)receive_result;
+    }
+    worker_ptr->elapsed_nanoseconds = now_ns() - start_time_ns;
+    free(receive_buffer);
+    return NULL;
+}
+
+static double run_loopback_stream(size_t message_size, int stream_count, uint64_t duration_nanoseconds)
+{
+    int listen_socket_fd = create_server_socket("127.0.0.1", 0, 0);
+    if (listen_socket_fd < 0)
+    {
+        return 0.0;
+    }
+    struct sockaddr_in listen_address;
+    socklen_t listen_address_length = sizeof(listen_address);
+    getsockname(listen_socket_fd, (struct sockaddr *)&listen_address, &listen_address_length);
+    int listen_port_number = ntohs(listen_address.sin_port);
+
+    pthread_t *thread_array = (pthread_t *)calloc((size_t)stream_count * 2, sizeof(pthread_t));
+    calibrate_worker_t *worker_array = (calibrate_worker_t *)calloc((size_t)stream_count * 2, sizeof(calibrate_worker_t));
+    if (!thread_array || !worker_array)
+    {
+        free(thread_array);
+        free(worker_array);
+        close(listen_socket_fd);
+        return 0.0;
+    }
+    atomic_int start_flag;
+    atomic_init(&start_flag, 0);
+    int connected_stream_count = 0;
+    for (int stream_index = 0; stream_index < stream_count; stream_index++)
+    {
+        int client_socket_fd = create_client_socket("127.0.0.1", listen_port_number);
+        int accepted_socket_fd = (client_socket_fd >= 0) ? accept(listen_socket_fd, NULL, NULL) : -1;
+        if (accepted_socket_fd < 0)
+        {
+            if (client_socket_fd >= 0)
+            {
+                close(client_socket_fd);
+            }
+            break;
+        }
+        calibrate_worker_t *sender_ptr = &worker_array[stream_index * 2];
+        calibrate_worker_t *receiver_ptr = &worker_array[stream_index * 2 + 1];
+        sender_ptr->thread_index = stream_index * 2;
+        sender_ptr->message_size = message_size;
+        sender_ptr->duration_nanoseconds = duration_nanoseconds;
+        sender_ptr->socket_file_descriptor = client_socket_fd;
+        sender_ptr->start_flag_ptr = &start_flag;
+        receiver_ptr->thread_index = stream_index * 2 + 1;
+        receiver_ptr->message_size = message_size;
+        receiver_ptr->socket_file_descriptor = accepted_socket_fd;
+        receiver_ptr->start_flag_ptr = &start_flag;
+        pthread_create(&thread_array[stream_index * 2], NULL, loopback_sender_main, sender_ptr);
+        pthread_create(&thread_array[stream_index * 2 + 1], NULL, loopback_receiver_main, receiver_ptr);
+        connected_stream_count++;
+    }
+    close(listen_socket_fd);
+    atomic_store_explicit(&start_flag, 1, memory_order_release);
+
+    uint64_t received_bytes_total = 0;
+    uint64_t maximum_elapsed_nanoseconds = 0;
+    for (int stream_index = 0; stream_index < connected_stream_count; stream_index++)
+    {
+        pthread_join(thread_array[stream_index * 2], NULL);
+        pthread_join(thread_array[stream_index * 2 + 1], NULL);
+        calibrate_worker_t *receiver_ptr = &worker_array[stream_index * 2 + 1];
+        received_bytes_total += receiver_ptr->transferred_bytes;
+        if (receiver_ptr->elapsed_nanoseconds > maximum_elapsed_nanoseconds)
+        {
+            maximum_elapsed_nanoseconds = receiver_ptr->elapsed_nanoseconds;
+        }
+        close(worker_array[stream_index * 2].socket_file_descriptor);
+        close(receiver_ptr->socket_file_descriptor);
+    }
+    free(thread_array);
+    free(worker_array);
+    return maximum_elapsed_nanoseconds ? (double)received_bytes_total * 8.0 / (double)maximum_elapsed_nanoseconds : 0.0;
+}
+
+static void *cacheline_responder_main(void *thread_argument)
+{
+    cacheline_pingpong_t *pingpong_ptr = (cacheline_pingpong_t *)thread_argument;
+    pin_thread(pingpong_ptr->cpu_core_ids[1]);
+    uint_fast64_t expected_sequence = 1;
+    while (1)
+    {
+        uint_fast64_t observed_sequence = atomic_load_explicit(&pingpong_ptr->shared_sequence, memory_order_acquire);
+        if (observed_sequence == UINT64_MAX)
+        {
+            break;
+        }
+        if (observed_sequence != expected_sequence)
+        {
+            if (pingpong_ptr->share_one_core)
+            {
+                sched_yield();
+            }
+            continue;
+        }
+        atomic_store_explicit(&pingpong_ptr->shared_sequence, expected_sequence + 1, memory_order_release);
+        expected_sequence += 2;
+    }
+    return NULL;
+}
+
+static double run_cacheline_pingpong(uint64_t duration_nanoseconds, int online_cpu_count)
+{
+    cacheline_pingpong_t *pingpong_ptr = (cacheline_pingpong_t *)aligned_alloc(64, sizeof(cacheline_pingpong_t));
+    if (!pingpong_ptr)
+    {
+        return 0.0;
+    }
+    memset(pingpong_ptr, 0, sizeof(*pingpong_ptr));
+    atomic_init(&pingpong_ptr->shared_sequence, 0);
+    pingpong_ptr->cpu_core_ids[0] = 0;
+    pingpong_ptr->cpu_core_ids[1] = (online_cpu_count > 1) ? 1 : 0;
+    pingpong_ptr->share_one_core = (online_cpu_count < 2);
+    pthread_t responder_thread;
+    pthread_create(&responder_thread, NULL, cacheline_responder_main, pingpong_ptr);
+    pin_thread(pingpong_ptr->cpu_core_ids[0]);
+
+    uint_fast64_t next_sequence = 1;
+    uint64_t round_trip_count = 0;
+    uint64_t start_time_ns = now_ns();
+    uint64_t elapsed_nanoseconds = 0;
+    while (elapsed_nanoseconds < duration_nanoseconds)
+    {
+        for (int round_index = 0; round_index < CALIBRATE_CLOCK_CHECK_INTERVAL; round_index++)
+        {
+            atomic_store_explicit(&pingpong_ptr->shared_sequence, next_sequence, memory_order_release);
+            while (atomic_load_explicit(&pingpong_ptr->shared_sequence, memory_order_acquire) != next_sequence + 1)
+            {
+                if (pingpong_ptr->share_one_core)
+                {
+                    sched_yield();
+                }
+            }
+            next_sequence += 2;
+        }
+        round_trip_count += CALIBRATE_CLOCK_CHECK_INTERVAL;
+        elapsed_nanoseconds = now_ns() - start_time_ns;
+    }
+    atomic_store_explicit(&pingpong_ptr->shared_sequence, UINT64_MAX, memory_order_release);
+    pthread_join(responder_thread, NULL);
+    free(pingpong_ptr);
+    return (double)elapsed_nanoseconds / (double)round_trip_count / 2.0;
+}
+
+static int parse_integer_list(const char *list_string, int *value_array, int maximum_values)
+{
+    int value_count = 0;
+    const char *cursor_ptr = list_string;
+    while (*cursor_ptr && value_count < maximum_values)
+    {
+        char *end_pointer = NULL;
+        long parsed_value = strtol(cursor_ptr, &end_pointer, 10);
+        if (end_pointer == cursor_ptr || parsed_value <= 0)
+        {
+            return -1;
+        }
+        value_array[value_count++] = (int)parsed_value;
+        cursor_ptr = (*end_pointer == ',') ? end_pointer + 1 : end_pointer;
+    }
+    return value_count;
+}
+
+static void usage_calibrate(const char *program_name)
+{
+    fprintf(stderr,
+            "Usage: %s [--msg-sizes 64,256,1024,4096] [--streams 1,2,4,8] [--threads n] [--duration-ms ms]\n",
+            program_name);
+}
+
+int main(int argument_count, char **argument_values)
+{
+    calibrate_config_t calibrate_config;
+    memset(&calibrate_config, 0, sizeof(calibrate_config));
+    int online_cpu_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int parsed_sizes[CALIBRATE_MAX_SIZES] = {64, 256, 1024, 4096};
+    calibrate_config.message_size_count = 4;
+    calibrate_config.stream_counts[0] = 1;
+    calibrate_config.stream_count_count = 1;
+    calibrate_config.all_core_threads = online_cpu_count > 0 ? online_cpu_count : 1;
+    calibrate_config.duration_nanoseconds = 500ULL * 1000000ULL;
+
+    for (int arg_index = 1; arg_index < argument_count; arg_index++)
+    {
+        if (strcmp(argument_values[arg_index], "--msg-sizes") == 0 && arg_index + 1 < argument_count)
+        {
+            calibrate_config.message_size_count = parse_integer_list(argument_values[++arg_index], parsed_sizes, CALIBRATE_MAX_SIZES);
+        }
+        else if (strcmp(argument_values[arg_index], "--streams") == 0 && arg_index + 1 < argument_count)
+        {
+            calibrate_config.stream_count_count = parse_integer_list(argument_values[++arg_index], calibrate_config.stream_counts, CALIBRATE_MAX_STREAM_COUNTS);
+        }
+        else if (strcmp(argument_values[arg_index], "--threads") == 0 && arg_index + 1 < argument_count)
+        {
+            calibrate_config.all_core_threads = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--duration-ms") == 0 && arg_index + 1 < argument_count)
+        {
+            calibrate_config.duration_nanoseconds = (uint64_t)atoi(argument_values[++arg_index]) * 1000000ULL;
+        }
+        else
+        {
+            usage_calibrate(argument_values[0]);
+            return 1;
+        }
+    }
+    if (calibrate_config.message_size_count <= 0 || calibrate_config.stream_count_count <= 0 ||
+        calibrate_config.all_core_threads < 1 || calibrate_config.duration_nanoseconds == 0)
+    {
+        usage_calibrate(argument_values[0]);
+        return 1;
+    }
+    for (int size_index = 0; size_index < calibrate_config.message_size_count; size_index++)
+    {
+        calibrate_config.message_sizes[size_index] = (size_t)parsed_sizes[size_index];
+    }
+
+    uint64_t duration_nanoseconds = calibrate_config.duration_nanoseconds;
+    report_ceiling("null_syscall", 0, 1, run_null_syscall(duration_nanoseconds), "ns");
+    report_ceiling("cacheline_pingpong", 64, 2, run_cacheline_pingpong(duration_nanoseconds, online_cpu_count), "ns");
+    for (int size_index = 0; size_index < calibrate_config.message_size_count; size_index++)
+    {
+        size_t message_size = calibrate_config.message_sizes[size_index];
+        report_ceiling("memcpy", message_size, 1, run_memcpy_bandwidth(message_size, 1, duration_nanoseconds), "gbps");
+        report_ceiling("memcpy", message_size, calibrate_config.all_core_threads,
+                       run_memcpy_bandwidth(message_size, calibrate_config.all_core_threads, duration_nanoseconds), "gbps");
+        report_ceiling("socketpair_pingpong", message_size, 2, run_socketpair_pingpong(message_size, duration_nanoseconds), "us");
+        for (int stream_index = 0; stream_index < calibrate_config.stream_count_count; stream_index++)
+        {
+            int stream_count = calibrate_config.stream_counts[stream_index];
+            report_ceiling("loopback_tcp_stream", message_size, stream_count, run_loopback_stream(message_size, stream_count, duration_nanoseconds), "gbps");
+        }
+    }
+    return 0;
+}
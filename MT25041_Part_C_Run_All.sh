@@ -66,19 +66,67 @@ print("PORT_A3=" + str(ports.get("a3", 5003)))
 print("ECHO=" + ("1" if cfg.get("echo", False) else "0"))
 print("PIN_BASE=" + str(cfg.get("pin_base_cpu", -1)))
 print("ZC_INFLIGHT=" + str(cfg.get("zerocopy_inflight", 32)))
+work = cfg.get("server_work", {})
+work_kind = str(work.get("kind", "spin"))
+service_ns = [str(v) for v in work.get("service_ns", [0])]
+if work_kind != "spin" and any(v != "0" for v in service_ns):
+    service_ns = [v for v in service_ns if v == "0"][:1] + [work_kind]
+    print(f"server_work.kind={work_kind} ignores service_ns; running without work and with {work_kind} only", file=sys.stderr)
+print("SERVICE_NS=" + ",".join(service_ns))
+print("WORK_KIND=" + work_kind)
+print("WORK_BYTES=" + str(work.get("working_set_bytes", 65536)))
+print("WORK_POOL=" + str(work.get("pool_threads", 0)))
+calibration = cfg.get("calibration", {})
+print("CALIBRATE=" + ("1" if calibration.get("enabled", True) else "0"))
+print("CALIBRATE_MS=" + str(calibration.get("duration_ms", 500)))
+udp = cfg.get("udp", {})
+print("UDP=" + ("1" if udp.get("enabled", True) else "0"))
+print("UDP_GSO=" + str(udp.get("gso_segments", 16)))
+print("UDP_BATCH=" + str(udp.get("batch", 16)))
+stripe = cfg.get("stripe", {})
+print("STRIPE=" + ("1" if stripe.get("enabled", True) else "0"))
+print("STRIPE_MSG_SIZE=" + str(stripe.get("msg_size", 67108864)))
+print("STRIPE_CONNECTIONS=" + ",".join(map(str, stripe.get("connections", [1, 2, 4, 8]))))
+print("STRIPE_CHUNK=" + str(stripe.get("chunk_size", 1048576)))
+tls = cfg.get("tls", {})
+print("TLS=" + ("1" if tls.get("enabled", True) else "0"))
+print("TLS_THREADS=" + str(tls.get("threads", 1)))
+sampling = cfg.get("kernel_sampling", {})
+print("SAMPLE_MS=" + (str(sampling.get("interval_ms", 100)) if sampling.get("enabled", True) else "0"))
 PY
 }
 
 eval "$(read_config)"
 IFS=',' read -r -a MSG_SIZES <<< "$MSG_SIZES"
 IFS=',' read -r -a THREADS <<< "$THREADS"
+IFS=',' read -r -a SERVICE_NS <<< "$SERVICE_NS"
+IFS=',' read -r -a STRIPE_CONNECTIONS <<< "$STRIPE_CONNECTIONS"
 
-total_runs=$((3 * ${#MSG_SIZES[@]} * ${#THREADS[@]} * 2))
+total_runs=$((3 * ${#MSG_SIZES[@]} * ${#THREADS[@]} * ${#SERVICE_NS[@]} * 2))
 done_runs=0
 
 make -C "$ROOT" clean all
 
-printf "impl,msg_size,threads,mode,throughput_gbps,latency_us,cycles,l1_miss,llc_miss,ctx_switches,total_bytes,duration_s\n" > "$RAW_CSV"
+CEILINGS_CSV="$OUT_DIR/MT25041_Part_B_Ceilings.csv"
+: > "$CEILINGS_CSV"
+if [[ "$CALIBRATE" == "1" ]]; then
+  echo "Calibrating host ceilings..."
+  "$ROOT/MT25041_Part_C_Calibrate" --msg-sizes "$(IFS=','; echo "${MSG_SIZES[*]}")" --streams "$(IFS=','; echo "${THREADS[*]}")" \
+    --duration-ms "$CALIBRATE_MS" > "$CEILINGS_CSV"
+  cat "$CEILINGS_CSV"
+fi
+
+printf "impl,msg_size,threads,mode,throughput_gbps,latency_us,cycles,l1_miss,llc_miss,ctx_switches,total_bytes,duration_s,service_ns,p50_us,p99_us,ceiling,ceiling_value,ceiling_fraction,work\n" > "$RAW_CSV"
+
+KERNEL_SAMPLES_CSV="$OUT_DIR/MT25041_Part_B_KernelSamples.csv"
+CPU_SAMPLES_CSV="$OUT_DIR/MT25041_Part_B_CpuSamples.csv"
+SOCKET_SAMPLES_CSV="$OUT_DIR/MT25041_Part_B_SocketSamples.csv"
+if [[ "$SAMPLE_MS" != "0" ]]; then
+  SAMPLE_KEY="impl,msg_size,threads,mode,work,service_ns,side,t_ms"
+  printf "%s,interval_ms,bytes,gbps,softirq_ms,net_rx,net_tx,in_segs,out_segs,retrans_segs,fast_retrans,timeouts,lost_retransmit,backlog_drop,rcvq_drop,prune_called,rcv_collapsed\n" "$SAMPLE_KEY" > "$KERNEL_SAMPLES_CSV"
+  printf "%s,cpu,softirq_ms,net_rx,net_tx\n" "$SAMPLE_KEY" > "$CPU_SAMPLES_CSV"
+  printf "%s,socket,rtt_us,rttvar_us,cwnd,unacked,notsent_bytes,total_retrans\n" "$SAMPLE_KEY" > "$SOCKET_SAMPLES_CSV"
+fi
 
 run_once() {
   local impl="$1"
@@ -87,10 +135,34 @@ run_once() {
   local threads="$4"
   local mode="$5"
   local echo_flag="$6"
-  local perf_out="$OUT_DIR/perf_${impl}_${msg_size}_${threads}_${mode}.txt"
-  local res_out="$OUT_DIR/res_${impl}_${msg_size}_${threads}_${mode}.txt"
+  local service_ns="$7"
+  local perf_out="$OUT_DIR/perf_${impl}_${msg_size}_${threads}_${mode}_${service_ns}.txt"
+  local res_out="$OUT_DIR/res_${impl}_${msg_size}_${threads}_${mode}_${service_ns}.txt"
+  local srv_out="$OUT_DIR/srv_${impl}_${msg_size}_${threads}_${mode}_${service_ns}.txt"
+  local work_label="none"
+  local service_value="0"
+  if [[ "$service_ns" != "0" ]]; then
+    work_label="$WORK_KIND"
+    if [[ "$WORK_KIND" == "spin" ]]; then
+      service_value="$service_ns"
+    fi
+  fi
+
+  local server_args=(--port "$port" --msg-size "$msg_size" --max-clients "$threads" --pin-base "$PIN_BASE")
+  if [[ "$echo_flag" == "--echo" ]]; then
+    server_args+=(--echo)
+  fi
+  if [[ "$service_ns" != "0" ]]; then
+    server_args+=(--work "$WORK_KIND" --work-bytes "$WORK_BYTES" --work-pool "$WORK_POOL")
+    if [[ "$WORK_KIND" == "spin" ]]; then
+      server_args+=(--work-ns "$service_ns")
+    fi
+  fi
+  if [[ "$SAMPLE_MS" != "0" ]]; then
+    server_args+=(--sample-ms "$SAMPLE_MS")
+  fi
 
-  "$ROOT/MT25041_Part_${impl}_Server" --port "$port" --msg-size "$msg_size" --max-clients "$threads" ${echo_flag} --pin-base "$PIN_BASE" &
+  "$ROOT/MT25041_Part_${impl}_Server" "${server_args[@]}" >"$srv_out" &
   local srv_pid=$!
   sleep 0.2
 
@@ -99,14 +171,36 @@ run_once() {
   if [[ "$echo_flag" == "--echo" ]]; then
     client_args+=(--echo)
   fi
+  if [[ "$SAMPLE_MS" != "0" ]]; then
+    client_args+=(--sample-ms "$SAMPLE_MS")
+  fi
 
   perf stat -x, -e cycles,context-switches,L1-dcache-load-misses,cache-misses -- "$client_bin" "${client_args[@]}" 1>"$res_out" 2>"$perf_out"
 
   wait "$srv_pid" || true
 
-  python3 - <<'PY' "$impl" "$msg_size" "$threads" "$mode" "$perf_out" "$res_out" "$RAW_CSV"
+  if [[ "$SAMPLE_MS" != "0" ]]; then
+    python3 - <<'PY' "$impl" "$msg_size" "$threads" "$mode" "$work_label" "$service_value" "$res_out" "$srv_out" "$KERNEL_SAMPLES_CSV" "$CPU_SAMPLES_CSV" "$SOCKET_SAMPLES_CSV"
 import sys, csv
-impl, msg_size, threads, mode, perf_out, res_out, raw_csv = sys.argv[1:]
+impl, msg_size, threads, mode, work_label, service_ns, res_out, srv_out, kernel_csv, cpu_csv, socket_csv = sys.argv[1:]
+targets = {"SAMPLE": kernel_csv, "SAMPLE_CPU": cpu_csv, "SAMPLE_SOCKET": socket_csv}
+rows = {path: [] for path in targets.values()}
+for side, path in (("client", res_out), ("server", srv_out)):
+    with open(path) as f:
+        for line in f:
+            fields = line.strip().split(',')
+            kind = fields[0][len("SERVER_"):] if side == "server" and fields[0].startswith("SERVER_") else fields[0]
+            if kind in targets:
+                rows[targets[kind]].append([impl, msg_size, threads, mode, work_label, service_ns, side] + fields[1:])
+for path, path_rows in rows.items():
+    with open(path, "a", newline="") as f:
+        csv.writer(f).writerows(path_rows)
+PY
+  fi
+
+  python3 - <<'PY' "$impl" "$msg_size" "$threads" "$mode" "$perf_out" "$res_out" "$RAW_CSV" "$service_value" "$CEILINGS_CSV" "$work_label"
+import sys, csv
+impl, msg_size, threads, mode, perf_out, res_out, raw_csv, service_ns, ceilings_csv, work_label = sys.argv[1:]
 
 metrics = {"cycles": 0, "context-switches": 0, "L1-dcache-load-misses": 0, "cache-misses": 0}
 with open(perf_out) as f:
@@ -122,16 +216,22 @@ with open(perf_out) as f:
                 pass
 
 result_line = None
+percentile_line = None
 with open(res_out) as f:
     for line in f:
-        if line.startswith("RESULT,"):
+        if line.startswith("RESULT,") and result_line is None:
             result_line = line.strip()
-            break
+        elif line.startswith("LATENCY_PERCENTILES,") and percentile_line is None:
+            percentile_line = line.strip()
 
 if not result_line:
     sys.exit(2)
 
 _, thr, lat, total_bytes, duration_s = result_line.split(',')
+p50 = p99 = 0.0
+if percentile_line:
+    fields = percentile_line.split(',')
+    p50, p99 = float(fields[1]), float(fields[3])
 thr = float(thr)
 lat = float(lat)
 if mode == "latency" and lat <= 0:
@@ -139,9 +239,32 @@ if mode == "latency" and lat <= 0:
 if mode == "throughput" and thr <= 0:
     sys.exit(4)
 
+ceilings = {}
+with open(ceilings_csv) as f:
+    for line in f:
+        fields = line.strip().split(',')
+        if len(fields) == 6 and fields[0] == "CEILING":
+            ceilings[(fields[1], int(fields[2]), int(fields[3]))] = float(fields[4])
+
+ceiling_name = ""
+ceiling_value = 0.0
+ceiling_fraction = 0.0
+if mode == "throughput":
+    streams = sorted(s for (name, size, s) in ceilings if name == "loopback_tcp_stream" and size == int(msg_size) and s <= int(threads))
+    if streams:
+        ceiling_name = "loopback_tcp_stream"
+        ceiling_value = ceilings[(ceiling_name, int(msg_size), streams[-1])]
+        ceiling_fraction = thr / ceiling_value if ceiling_value > 0 else 0.0
+elif ("socketpair_pingpong", int(msg_size), 2) in ceilings:
+    ceiling_name = "socketpair_pingpong"
+    ceiling_value = ceilings[(ceiling_name, int(msg_size), 2)]
+    ceiling_fraction = ceiling_value / lat if lat > 0 else 0.0
+
 row = [impl, msg_size, threads, mode, f"{thr:.6f}", f"{lat:.3f}",
        str(metrics["cycles"]), str(metrics["L1-dcache-load-misses"]), str(metrics["cache-misses"]),
-       str(metrics["context-switches"]), total_bytes, f"{float(duration_s):.6f}"]
+       str(metrics["context-switches"]), total_bytes, f"{float(duration_s):.6f}",
+       service_ns, f"{p50:.3f}", f"{p99:.3f}",
+       ceiling_name, f"{ceiling_value:.6f}", f"{ceiling_fraction:.4f}", work_label]
 
 with open(raw_csv, "a", newline="") as f:
     csv.writer(f).writerow(row)
@@ -155,7 +278,9 @@ summary = (
   f"Mode: {mode}\n"
   "---------------- Results ----------------\n"
   f"Throughput: {thr:.6f} Gbps\n"
-  f"Latency: {lat:.3f} us\n"
+  f"Server work: {work_label}" + (f" {service_ns} ns" if work_label == "spin" else "") + "\n"
+  f"Latency: {lat:.3f} us (p50 {p50:.3f}, p99 {p99:.3f})\n"
+  f"Ceiling: {ceiling_name or 'n/a'} {ceiling_value:.3f} (fraction {ceiling_fraction:.4f})\n"
   f"CPU cycles: {metrics['cycles']}\n"
   f"L1 misses: {metrics['L1-dcache-load-misses']}\n"
   f"LLC misses: {metrics['cache-misses']}\n"
@@ -194,26 +319,269 @@ for impl in A1 A2 A3; do
     for threads in "${THREADS[@]}"; do
       warmup_run "$impl" "$port" "$msg_size" "$threads"
 
-      for mode in throughput latency; do
-        echo_flag=""
-        if [[ "$mode" == "latency" || "$ECHO" == "1" ]]; then
-          echo_flag="--echo"
+      for service_ns in "${SERVICE_NS[@]}"; do
+        for mode in throughput latency; do
+          echo_flag=""
+          if [[ "$mode" == "latency" || "$ECHO" == "1" ]]; then
+            echo_flag="--echo"
+          fi
+          done_runs=$((done_runs + 1))
+          echo "Progress: ${done_runs}/${total_runs} | ${impl} size=${msg_size} threads=${threads} service=${service_ns} mode=${mode}"
+          attempt=0
+          until run_once "$impl" "$port" "$msg_size" "$threads" "$mode" "$echo_flag" "$service_ns"; do
+            attempt=$((attempt + 1))
+            if [[ "$attempt" -gt "$RETRIES" ]]; then
+              echo "Failed: $impl size=$msg_size threads=$threads service=${service_ns} mode=$mode" >&2
+              exit 1
+            fi
+            sleep 0.2
+          done
+        done
+      done
+    done
+  done
+done
+
+udp_once() {
+  local impl="$1"
+  local port="$2"
+  local msg_size="$3"
+  local threads="$4"
+  local res_out="$OUT_DIR/udp_${impl}_${msg_size}_${threads}.txt"
+
+  "$ROOT/MT25041_Part_${impl}_Server" --udp --port "$port" --msg-size "$msg_size" --max-clients "$threads" --pin-base "$PIN_BASE" &
+  local srv_pid=$!
+  sleep 0.2
+
+  local status=0
+  "$ROOT/MT25041_Part_${impl}_Client" --udp --host "$HOST" --port "$port" --msg-size "$msg_size" --threads "$threads" --duration "$DURATION" \
+    --pin-base "$PIN_BASE" --zc-inflight "$ZC_INFLIGHT" --udp-gso "$UDP_GSO" --send-batch "$UDP_BATCH" >"$res_out" || status=$?
+  wait "$srv_pid" || true
+  if [[ "$status" -ne 0 ]]; then
+    return "$status"
+  fi
+
+  python3 - <<'PY' "$impl" "$msg_size" "$res_out" "$UDP_CSV"
+import sys, csv
+impl, msg_size, res_out, udp_csv = sys.argv[1:]
+goodput = None
+udp_fields = None
+with open(res_out) as f:
+    for line in f:
+        if line.startswith("RESULT,") and goodput is None:
+            goodput = float(line.split(',')[1])
+        elif line.startswith("UDP,"):
+            udp_fields = line.strip().split(',')[1:]
+if goodput is None or not udp_fields:
+    sys.exit(2)
+threads, gso, batch, zerocopy, sent, received, lost, loss_pct, reordered, offered, per_syscall, _ = udp_fields
+with open(udp_csv, "a", newline="") as f:
+    csv.writer(f).writerow([impl, msg_size, threads, gso, batch, zerocopy, f"{goodput:.6f}", offered,
+                            sent, received, lost, loss_pct, reordered, per_syscall])
+print(f"UDP {impl} size={msg_size} threads={threads}: goodput {goodput:.3f} Gbps, offered {offered} Gbps, "
+      f"loss {loss_pct}%, reordered {reordered}, {per_syscall} datagrams/syscall")
+PY
+}
+
+if [[ "$UDP" == "1" ]]; then
+  UDP_CSV="$OUT_DIR/MT25041_Part_B_UdpData.csv"
+  printf "impl,msg_size,threads,gso_segments,batch,zerocopy,goodput_gbps,offered_gbps,sent,received,lost,loss_pct,reordered,datagrams_per_syscall\n" > "$UDP_CSV"
+  for impl in A1 A2 A3; do
+    case "$impl" in
+      A1) port="$PORT_A1";;
+      A2) port="$PORT_A2";;
+      A3) port="$PORT_A3";;
+    esac
+    for msg_size in "${MSG_SIZES[@]}"; do
+      for threads in "${THREADS[@]}"; do
+        attempt=0
+        until udp_once "$impl" "$port" "$msg_size" "$threads"; do
+          attempt=$((attempt + 1))
+          if [[ "$attempt" -gt "$RETRIES" ]]; then
+            echo "Failed: UDP $impl size=$msg_size threads=$threads" >&2
+            exit 1
+          fi
+          sleep 0.2
+        done
+      done
+    done
+  done
+fi
+
+stripe_once() {
+  local impl="$1"
+  local port="$2"
+  local connections="$3"
+  local res_out="$OUT_DIR/stripe_${impl}_${connections}.txt"
+
+  "$ROOT/MT25041_Part_${impl}_Server" --stripe "$connections" --port "$port" --msg-size "$STRIPE_MSG_SIZE" --pin-base "$PIN_BASE" &
+  local srv_pid=$!
+  sleep 0.2
+
+  local status=0
+  "$ROOT/MT25041_Part_${impl}_Client" --stripe "$connections" --host "$HOST" --port "$port" --msg-size "$STRIPE_MSG_SIZE" \
+    --chunk-size "$STRIPE_CHUNK" --duration "$DURATION" --pin-base "$PIN_BASE" >"$res_out" || status=$?
+  wait "$srv_pid" || status=$?
+  if [[ "$status" -ne 0 ]]; then
+    return "$status"
+  fi
+
+  python3 - <<'PY' "$impl" "$res_out" "$STRIPE_CSV"
+import sys, csv
+impl, res_out, stripe_csv = sys.argv[1:]
+result = stripe = completion = None
+with open(res_out) as f:
+    for line in f:
+        fields = line.strip().split(',')
+        if fields[0] == "RESULT" and result is None:
+            result = fields
+        elif fields[0] == "STRIPE":
+            stripe = fields
+        elif fields[0] == "COMPLETION_PERCENTILES":
+            completion = fields
+if not result or not stripe or not completion:
+    sys.exit(2)
+_, connections, msg_size, chunk_size, zerocopy, messages, gbps = stripe
+with open(stripe_csv, "a", newline="") as f:
+    csv.writer(f).writerow([impl, msg_size, connections, chunk_size, zerocopy, messages, gbps,
+                            result[2], completion[1], completion[3]])
+print(f"STRIPE {impl} K={connections}: {float(gbps):.3f} Gbps, {messages} messages, "
+      f"completion p50 {completion[1]} us, p99 {completion[3]} us")
+PY
+}
+
+if [[ "$STRIPE" == "1" ]]; then
+  STRIPE_CSV="$OUT_DIR/MT25041_Part_B_StripeData.csv"
+  printf "impl,msg_size,connections,chunk_size,zerocopy,messages,aggregate_gbps,completion_mean_us,completion_p50_us,completion_p99_us\n" > "$STRIPE_CSV"
+  for impl in A1 A2 A3; do
+    case "$impl" in
+      A1) port="$PORT_A1";;
+      A2) port="$PORT_A2";;
+      A3) port="$PORT_A3";;
+    esac
+    for connections in "${STRIPE_CONNECTIONS[@]}"; do
+      attempt=0
+      until stripe_once "$impl" "$port" "$connections"; do
+        attempt=$((attempt + 1))
+        if [[ "$attempt" -gt "$RETRIES" ]]; then
+          echo "Failed: stripe $impl connections=$connections" >&2
+          exit 1
         fi
-        done_runs=$((done_runs + 1))
-        echo "Progress: ${done_runs}/${total_runs} | ${impl} size=${msg_size} threads=${threads} mode=${mode}"
+        sleep 0.2
+      done
+    done
+  done
+fi
+
+tls_once() {
+  local impl="$1"
+  local port="$2"
+  local msg_size="$3"
+  local variant="$4"
+  local tag="${impl}_${msg_size}_${variant}"
+  local tls_args=()
+  if [[ "$variant" == "tls" ]]; then
+    tls_args=(--tls)
+  fi
+
+  perf stat -x, -e cycles -- "$ROOT/MT25041_Part_${impl}_Server" --port "$port" --msg-size "$msg_size" --max-clients "$TLS_THREADS" \
+    --pin-base "$PIN_BASE" "${tls_args[@]}" >/dev/null 2>"$OUT_DIR/tls_srv_perf_${tag}.txt" &
+  local srv_pid=$!
+  sleep 0.2
+
+  local status=0
+  perf stat -x, -e cycles -- "$ROOT/MT25041_Part_${impl}_Client" --host "$HOST" --port "$port" --msg-size "$msg_size" --threads "$TLS_THREADS" \
+    --duration "$DURATION" --mode throughput --pin-base "$PIN_BASE" --zc-inflight "$ZC_INFLIGHT" "${tls_args[@]}" \
+    >"$OUT_DIR/tls_res_${tag}.txt" 2>"$OUT_DIR/tls_cli_perf_${tag}.txt" || status=$?
+  wait "$srv_pid" || status=$?
+  return "$status"
+}
+
+TLS_AVAILABLE=$(python3 - <<'PY'
+import socket
+listener = socket.socket()
+listener.bind(("127.0.0.1", 0))
+listener.listen(1)
+connection = socket.create_connection(listener.getsockname())
+try:
+    connection.setsockopt(socket.IPPROTO_TCP, 31, b"tls")
+    print(1)
+except OSError:
+    print(0)
+PY
+)
+
+if [[ "$TLS" == "1" && "$TLS_AVAILABLE" != "1" ]]; then
+  echo "Skipping kTLS pass: the tls ULP is not available (modprobe tls)"
+elif [[ "$TLS" == "1" ]]; then
+  TLS_CSV="$OUT_DIR/MT25041_Part_B_TlsData.csv"
+  printf "impl,msg_size,threads,tls_send_path,plain_gbps,tls_gbps,tls_throughput_ratio,plain_client_cycles_per_byte,tls_client_cycles_per_byte,plain_server_cycles_per_byte,tls_server_cycles_per_byte,encrypt_cycles_per_byte,decrypt_cycles_per_byte\n" > "$TLS_CSV"
+  for impl in A1 A2 A3; do
+    case "$impl" in
+      A1) port="$PORT_A1";;
+      A2) port="$PORT_A2";;
+      A3) port="$PORT_A3";;
+    esac
+    for msg_size in "${MSG_SIZES[@]}"; do
+      for variant in plain tls; do
         attempt=0
-        until run_once "$impl" "$port" "$msg_size" "$threads" "$mode" "$echo_flag"; do
+        until tls_once "$impl" "$port" "$msg_size" "$variant"; do
           attempt=$((attempt + 1))
           if [[ "$attempt" -gt "$RETRIES" ]]; then
-            echo "Failed: $impl size=$msg_size threads=$threads mode=$mode" >&2
+            echo "Failed: tls $impl msg=$msg_size $variant" >&2
             exit 1
           fi
           sleep 0.2
         done
       done
+
+      python3 - <<'PY' "$impl" "$msg_size" "$TLS_THREADS" "$OUT_DIR" "$TLS_CSV"
+import sys, csv
+impl, msg_size, threads, out_dir, tls_csv = sys.argv[1:]
+
+def cycles(path):
+    with open(path) as f:
+        for line in f:
+            parts = [p.strip() for p in line.split(',')]
+            if len(parts) >= 3 and parts[2] == "cycles":
+                try:
+                    return float(parts[0])
+                except ValueError:
+                    return 0.0
+    return 0.0
+
+measured = {}
+send_path = ""
+for variant in ("plain", "tls"):
+    tag = f"{impl}_{msg_size}_{variant}"
+    gbps = 0.0
+    total_bytes = 0
+    with open(f"{out_dir}/tls_res_{tag}.txt") as f:
+        for line in f:
+            fields = line.strip().split(',')
+            if fields[0] == "RESULT" and total_bytes == 0:
+                gbps, total_bytes = float(fields[1]), int(fields[3])
+            elif fields[0] == "TLS":
+                send_path = fields[2]
+    if total_bytes == 0:
+        sys.exit(2)
+    measured[variant] = (gbps,
+                         cycles(f"{out_dir}/tls_cli_perf_{tag}.txt") / total_bytes,
+                         cycles(f"{out_dir}/tls_srv_perf_{tag}.txt") / total_bytes)
+
+plain_gbps, plain_client_cpb, plain_server_cpb = measured["plain"]
+tls_gbps, tls_client_cpb, tls_server_cpb = measured["tls"]
+ratio = tls_gbps / plain_gbps if plain_gbps > 0 else 0.0
+with open(tls_csv, "a", newline="") as f:
+    csv.writer(f).writerow([impl, msg_size, threads, send_path, f"{plain_gbps:.6f}", f"{tls_gbps:.6f}", f"{ratio:.4f}",
+                            f"{plain_client_cpb:.4f}", f"{tls_client_cpb:.4f}", f"{plain_server_cpb:.4f}", f"{tls_server_cpb:.4f}",
+                            f"{tls_client_cpb - plain_client_cpb:.4f}", f"{tls_server_cpb - plain_server_cpb:.4f}"])
+print(f"TLS {impl} {msg_size}B via {send_path}: {plain_gbps:.3f} -> {tls_gbps:.3f} Gbps ({ratio:.2f}x), "
+      f"+{tls_client_cpb - plain_client_cpb:.3f} client / +{tls_server_cpb - plain_server_cpb:.3f} server cycles/byte")
+PY
     done
   done
-done
+fi
 
 echo ""
 echo "==============================================="
@@ -0,0 +1,979 @@
+#include "MT25041_Part_Transport.h"
+
+#include <ctype.h>
+#include <libgen.h>
+#include <limits.h>
+#include <math.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#define SWEEP_MAX_VALUES 32
+#define SWEEP_MAX_OUTPUT 8192
+#define SWEEP_MAX_TRIAL_ATTEMPTS 3
+#define SWEEP_SERVER_EXIT_WAIT_MS 3000
+#define SWEEP_SERVER_START_WAIT_MS 200
+
+enum json_type
+{
+    JSON_NULL = 0,
+    JSON_BOOLEAN = 1,
+    JSON_NUMBER = 2,
+    JSON_STRING = 3,
+    JSON_ARRAY = 4,
+    JSON_OBJECT = 5
+};
+
+typedef struct json_value
+{
+    enum json_type value_type;
+    double number_value;
+    char *string_value;
+    char **member_keys;
+    struct json_value **member_values;
+    int member_count;
+} json_value_t;
+
+typedef struct
+{
+    const char *text_pointer;
+} json_parser_t;
+
+typedef struct
+{
+    char binary_directory[PATH_MAX];
+    char host_address[64];
+    int message_sizes[SWEEP_MAX_VALUES];
+    int message_size_count;
+    int thread_counts[SWEEP_MAX_VALUES];
+    int thread_count_count;
+    int service_nanoseconds[SWEEP_MAX_VALUES];
+    int service_nanosecond_count;
+    double duration_seconds;
+    double warmup_seconds;
+    int echo_enabled;
+    int zerocopy_inflight;
+    char work_kind[32];
+    int work_working_set_bytes;
+    int work_pool_threads;
+    double confidence_target;
+    int minimum_trials;
+    int maximum_trials;
+    double warmup_tolerance;
+    int maximum_warmup_trials;
+    double throughput_regression_threshold;
+    double p99_regression_threshold;
+    int base_port;
+    int maximum_parallel_jobs;
+} sweep_config_t;
+
+typedef struct
+{
+    char implementation_name[4];
+    int message_size;
+    int thread_count;
+    int latency_mode;
+    int service_nanoseconds;
+    int core_count;
+    int first_core;
+    int port_number;
+    pid_t runner_pid;
+    int result_pipe_fd;
+    char result_row[512];
+} sweep_job_t;
+
+typedef struct
+{
+    double throughput_gbps;
+    double latency_microseconds;
+    double p50_microseconds;
+    double p99_microseconds;
+} sweep_trial_t;
+
+static void json_skip_space(json_parser_t *parser_ptr)
+{
+    while (isspace((unsigned char)*parser_ptr->text_pointer))
+    {
+        parser_ptr->text_pointer++;
+    }
+}
+
+static void json_free(json_value_t *value_ptr)
+{
+    if (!value_ptr)
+    {
+        return;
+    }
+    for (int member_index = 0; member_index < value_ptr->member_count; member_index++)
+    {
+        if (value_ptr->member_keys)
+        {
+            free(value_ptr->member_keys[member_index]);
+        }
+        json_free(value_ptr->member_values[member_index]);
+    }
+    free(value_ptr->member_keys);
+    free(value_ptr->member_values);
+    free(value_ptr->string_value);
+    free(value_ptr);
+}
+
+static char *json_parse_string(json_parser_t *parser_ptr)
+{
+    if (*parser_ptr->text_pointer != '"')
+    {
+        return NULL;
+    }
+    parser_ptr->text_pointer++;
+    const char *string_start = parser_ptr->text_pointer;
+    while (*parser_ptr->text_pointer && *parser_ptr->text_pointer != '"')
+    {
+        if (*parser_ptr->text_pointer == '\\' && parser_ptr->text_pointer[1])
+        {
+            parser_ptr->text_pointer++;
+        }
+        parser_ptr->text_pointer++;
+    }
+    if (*parser_ptr->text_pointer != '"')
+    {
+        return NULL;
+    }
+    size_t string_length = (size_t)(parser_ptr->text_pointer - string_start);
+    parser_ptr->text_pointer++;
+    char *string_copy = (char *)malloc(string_length + 1);
+    if (string_copy)
+    {
+        memcpy(string_copy, string_start, string_length);
+        string_copy[string_length] = '\0';
+    }
+    return string_copy;
+}
+
+static int json_append_member(json_value_t *container_ptr, char *member_key, json_value_t *member_value)
+{
+    char **grown_keys = NULL;
+    if (container_ptr->value_type == JSON_OBJECT)
+    {
+        grown_keys = (char **)realloc(container_ptr->member_keys, sizeof(char *) * (size_t)(container_ptr->member_count + 1));
+        if (!grown_keys)
+        {
+            return -1;
+        }
+        container_ptr->member_keys = grown_keys;
+    }
+    json_value_t **grown_values = (json_value_t **)realloc(container_ptr->member_values, sizeof(json_value_t *) * (size_t)(container_ptr->member_count + 1));
+    if (!grown_values)
+    {
+        return -1;
+    }
+    container_ptr->member_values = grown_values;
+    if (grown_keys)
+    {
+        container_ptr->member_keys[container_ptr->member_count] = member_key;
+    }
+    container_ptr->member_values[container_ptr->member_count] = member_value;
+    container_ptr->member_count++;
+    return 0;
+}
+
+static json_value_t *json_parse_value(json_parser_t *parser_ptr)
+{
+    json_skip_space(parser_ptr);
+    json_value_t *value_ptr = (json_value_t *)calloc(1, sizeof(json_value_t));
+    if (!value_ptr)
+    {
+        return NULL;
+    }
+    char leading_char = *parser_ptr->text_pointer;
+    if (leading_char == '{' || leading_char == '[')
+    {
+        char closing_char = (leading_char == '{') ? '}' : ']';
+        value_ptr->value_type = (leading_char == '{') ? JSON_OBJECT : JSON_ARRAY;
+        parser_ptr->text_pointer++;
+        json_skip_space(parser_ptr);
+        while (*parser_ptr->text_pointer && *parser_ptr->text_pointer != closing_char)
+        {
+            char *member_key = NULL;
+            if (value_ptr->value_type == JSON_OBJECT)
+            {
+                member_key = json_parse_string(parser_ptr);
+                json_skip_space(parser_ptr);
+                if (!member_key || *parser_ptr->text_pointer != ':')
+                {
+                    free(member_key);
+                    json_free(value_ptr);
+                    return NULL;
+                }
+                parser_ptr->text_pointer++;
+            }
+            json_value_t *member_value = json_parse_value(parser_ptr);
+            if (!member_value || json_append_member(value_ptr, member_key, member_value) != 0)
+            {
+                free(member_key);
+                json_free(member_value);
+                json_free(value_ptr);
+                return NULL;
+            }
+            json_skip_space(parser_ptr);
+            if (*parser_ptr->text_pointer == ',')
+            {
+                parser_ptr->text_pointer++;
+                json_skip_space(parser_ptr);
+            }
+        }
+        if (*parser_ptr->text_pointer != closing_char)
+        {
+            json_free(value_ptr);
+            return NULL;
+        }
+        parser_ptr->text_pointer++;
+    }
+    else if (leading_char == '"')
+    {
+        value_ptr->value_type = JSON_STRING;
+        value_ptr->string_value = json_parse_string(parser_ptr);
+        if (!value_ptr->string_value)
+        {
+            json_free(value_ptr);
+            return NULL;
+        }
+    }
+    else if (strncmp(parser_ptr->text_pointer, "true", 4) == 0 || strncmp(parser_ptr->text_pointer, "false", 5) == 0)
+    {
+        value_ptr->value_type = JSON_BOOLEAN;
+        value_ptr->number_value = (leading_char == 't') ? 1.0 : 0.0;
+        parser_ptr->text_pointer += (leading_char == 't') ? 4 : 5;
+    }
+    else if (strncmp(parser_ptr->text_pointer, "null", 4) == 0)
+    {
+        parser_ptr->text_pointer += 4;
+    }
+    else
+    {
+        char *end_pointer = NULL;
+        value_ptr->value_type = JSON_NUMBER;
+        value_ptr->number_value = strtod(parser_ptr->text_pointer, &end_pointer);
+        if (end_pointer == parser_ptr->text_pointer)
+        {
+            json_free(value_ptr);
+            return NULL;
+        }
+        parser_ptr->text_pointer = end_pointer;
+    }
+    return value_ptr;
+}
+
+static const json_value_t *json_object_get(const json_value_t *object_ptr, const char *member_key)
+{
+    if (!object_ptr || object_ptr->value_type != JSON_OBJECT)
+    {
+        return NULL;
+    }
+    for (int member_index = 0; member_index < object_ptr->member_count; member_index++)
+    {
+        if (strcmp(object_ptr->member_keys[member_index], member_key) == 0)
+        {
+            return object_ptr->member_values[member_index];
+        }
+    }
+    return NULL;
+}
+
+static double json_number_or(const json_value_t *object_ptr, const char *member_key, double default_value)
+{
+    const json_value_t *member_ptr = json_object_get(object_ptr, member_key);
+    if (member_ptr && (member_ptr->value_type == JSON_NUMBER || member_ptr->value_type == JSON_BOOLEAN))
+    {
+        return member_ptr->number_value;
+    }
+    return default_value;
+}
+
+static int json_integer_list(const json_value_t *object_ptr, const char *member_key, int *value_array, int default_value)
+{
+    const json_value_t *member_ptr = json_object_get(object_ptr, member_key);
+    if (!member_ptr || member_ptr->value_type != JSON_ARRAY)
+    {
+        value_array[0] = default_value;
+        return 1;
+    }
+    int value_count = 0;
+    for (int member_index = 0; member_index < member_ptr->member_count && value_count < SWEEP_MAX_VALUES; member_index++)
+    {
+        value_array[value_count++] = (int)member_ptr->member_values[member_index]->number_value;
+    }
+    return value_count;
+}
+
+static int load_sweep_config(const char *config_path, sweep_config_t *sweep_config)
+{
+    FILE *config_file = fopen(config_path, "r");
+    if (!config_file)
+    {
+        perror(config_path);
+        return -1;
+    }
+    char *config_text = (char *)calloc(1, 1 << 20);
+    size_t config_length = config_text ? fread(config_text, 1, (1 << 20) - 1, config_file) : 0;
+    fclose(config_file);
+    if (!config_text || config_length == 0)
+    {
+        free(config_text);
+        return -1;
+    }
+    json_parser_t json_parser = {config_text};
+    json_value_t *root_ptr = json_parse_value(&json_parser);
+    free(config_text);
+    if (!root_ptr || root_ptr->value_type != JSON_OBJECT)
+    {
+        fprintf(stderr, "%s: not a JSON object\n", config_path);
+        json_free(root_ptr);
+        return -1;
+    }
+
+    const json_value_t *host_ptr = json_object_get(root_ptr, "host");
+    snprintf(sweep_config->host_address, sizeof(sweep_config->host_address), "%s",
+             (host_ptr && host_ptr->value_type == JSON_STRING) ? host_ptr->string_value : "127.0.0.1");
+    sweep_config->message_size_count = json_integer_list(root_ptr, "message_sizes", sweep_config->message_sizes, 1024);
+    sweep_config->thread_count_count = json_integer_list(root_ptr, "thread_counts", sweep_config->thread_counts, 1);
+    sweep_config->duration_seconds = json_number_or(root_ptr, "duration_sec", 5.0);
+    sweep_config->warmup_seconds = json_number_or(root_ptr, "warmup_sec", 1.0);
+    sweep_config->echo_enabled = (int)json_number_or(root_ptr, "echo", 0.0);
+    sweep_config->zerocopy_inflight = (int)json_number_or(root_ptr, "zerocopy_inflight", 32.0);
+
+    const json_value_t *work_ptr = json_object_get(root_ptr, "server_work");
+    sweep_config->service_nanosecond_count = json_integer_list(work_ptr, "service_ns", sweep_config->service_nanoseconds, 0);
+    const json_value_t *work_kind_ptr = json_object_get(work_ptr, "kind");
+    snprintf(sweep_config->work_kind, sizeof(sweep_config->work_kind), "%s",
+             (work_kind_ptr && work_kind_ptr->value_type == JSON_STRING) ? work_kind_ptr->string_value : "spin");
+    sweep_config->work_working_set_bytes = (int)json_number_or(work_ptr, "working_set_bytes", 65536.0);
+    sweep_config->work_pool_threads = (int)json_number_or(work_ptr, "pool_threads", 0.0);
+
+    const json_value_t *sweep_ptr = json_object_get(root_ptr, "sweep");
+    sweep_config->confidence_target = json_number_or(sweep_ptr, "ci_target", 0.05);
+    sweep_config->minimum_trials = (int)json_number_or(sweep_ptr, "min_trials", 3.0);
+    sweep_config->maximum_trials = (int)json_number_or(sweep_ptr, "max_trials", 10.0);
+    sweep_config->warmup_tolerance = json_number_or(sweep_ptr, "warmup_tolerance", 0.05);
+    sweep_config->maximum_warmup_trials = (int)json_number_or(sweep_ptr, "max_warmup_trials", 5.0);
+    sweep_config->throughput_regression_threshold = json_number_or(sweep_ptr, "throughput_regression", 0.10);
+    sweep_config->p99_regression_threshold = json_number_or(sweep_ptr, "p99_regression", 0.20);
+    sweep_config->base_port = (int)json_number_or(sweep_ptr, "base_port", 5200.0);
+    sweep_config->maximum_parallel_jobs = (int)json_number_or(sweep_ptr, "max_parallel", 0.0);
+    json_free(root_ptr);
+
+    if (sweep_config->minimum_trials < 2)
+    {
+        sweep_config->minimum_trials = 2;
+    }
+    if (sweep_config->maximum_trials < sweep_config->minimum_trials)
+    {
+        sweep_config->maximum_trials = sweep_config->minimum_trials;
+    }
+    return 0;
+}
+
+static double student_t_quantile_975(int degrees_of_freedom)
+{
+    static const double quantile_table[] = {
+        0.0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (degrees_of_freedom < 1)
+    {
+        return 0.0;
+    }
+    if (degrees_of_freedom < (int)(sizeof(quantile_table) / sizeof(quantile_table[0])))
+    {
+        return quantile_table[degrees_of_freedom];
+    }
+    return 1.960;
+}
+
+static void sample_statistics(const double *sample_array, int sample_count, double *mean_ptr, double *half_width_ptr)
+{
+    double sample_sum = 0.0;
+    for (int sample_index = 0; sample_index < sample_count; sample_index++)
+    {
+        sample_sum += sample_array[sample_index];
+    }
+    double sample_mean = sample_count ? sample_sum / sample_count : 0.0;
+    double squared_deviation_sum = 0.0;
+    for (int sample_index = 0; sample_index < sample_count; sample_index++)
+    {
+        squared_deviation_sum += (sample_array[sample_index] - sample_mean) * (sample_array[sample_index] - sample_mean);
+    }
+    double standard_deviation = (sample_count > 1) ? sqrt(squared_deviation_sum / (sample_count - 1)) : 0.0;
+    *mean_ptr = sample_mean;
+    *half_width_ptr = (sample_count > 1) ? student_t_quantile_975(sample_count - 1) * standard_deviation / sqrt((double)sample_count) : 0.0;
+}
+
+static int wait_for_child(pid_t child_pid, int timeout_milliseconds)
+{
+    for (int waited_milliseconds = 0; waited_milliseconds < timeout_milliseconds; waited_milliseconds += 10)
+    {
+        int child_status = 0;
+        pid_t wait_result = waitpid(child_pid, &child_status, WNOHANG);
+        if (wait_result == child_pid)
+        {
+            return WIFEXITED(child_status) ? WEXITSTATUS(child_status) : -1;
+        }
+        if (wait_result < 0)
+        {
+            return -1;
+        }
+        struct timespec poll_delay = {0, 10000000L};
+        nanosleep(&poll_delay, NULL);
+    }
+    kill(child_pid, SIGKILL);
+    waitpid(child_pid, NULL, 0);
+    return -1;
+}
+
+static pid_t spawn_process(char *const *argument_vector, int stdout_fd)
+{
+    pid_t child_pid = fork();
+    if (child_pid == 0)
+    {
+        int null_fd = open("/dev/null", O_WRONLY);
+        dup2(stdout_fd >= 0 ? stdout_fd : null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+        execv(argument_vector[0], argument_vector);
+        _exit(127);
+    }
+    return child_pid;
+}
+
+static int run_trial(const sweep_config_t *sweep_config, const sweep_job_t *sweep_job, double duration_seconds, sweep_trial_t *trial_ptr)
+{
+    char server_path[PATH_MAX + 32];
+    char client_path[PATH_MAX + 32];
+    char port_string[16], size_string[16], thread_string[16], duration_string[32];
+    char server_pin_string[16], client_pin_string[16], inflight_string[16];
+    char service_string[16], work_bytes_string[16], work_pool_string[16], work_kind_string[32];
+    snprintf(server_path, sizeof(server_path), "%s/MT25041_Part_%s_Server", sweep_config->binary_directory, sweep_job->implementation_name);
+    snprintf(client_path, sizeof(client_path), "%s/MT25041_Part_%s_Client", sweep_config->binary_directory, sweep_job->implementation_name);
+    snprintf(port_string, sizeof(port_string), "%d", sweep_job->port_number);
+    snprintf(size_string, sizeof(size_string), "%d", sweep_job->message_size);
+    snprintf(thread_string, sizeof(thread_string), "%d", sweep_job->thread_count);
+    snprintf(duration_string, sizeof(duration_string), "%d", duration_seconds < 1.0 ? 1 : (int)(duration_seconds + 0.5));
+    snprintf(server_pin_string, sizeof(server_pin_string), "%d", sweep_job->first_core);
+    snprintf(client_pin_string, sizeof(client_pin_string), "%d", sweep_job->first_core < 0 ? -1 : sweep_job->first_core + sweep_job->thread_count);
+    snprintf(inflight_string, sizeof(inflight_string), "%d", sweep_config->zerocopy_inflight);
+    snprintf(service_string, sizeof(service_string), "%d", sweep_job->service_nanoseconds);
+    snprintf(work_bytes_string, sizeof(work_bytes_string), "%d", sweep_config->work_working_set_bytes);
+    snprintf(work_pool_string, sizeof(work_pool_string), "%d", sweep_config->work_pool_threads);
+    snprintf(work_kind_string, sizeof(work_kind_string), "%s", sweep_config->work_kind);
+    int echo_enabled = sweep_job->latency_mode || sweep_config->echo_enabled;
+
+    char *server_arguments[24];
+    int server_argument_count = 0;
+    server_arguments[server_argument_count++] = server_path;
+    server_arguments[server_argument_count++] = "--port";
+    server_arguments[server_argument_count++] = port_string;
+    server_arguments[server_argument_count++] = "--msg-size";
+    server_arguments[server_argument_count++] = size_string;
+    server_arguments[server_argument_count++] = "--max-clients";
+    server_arguments[server_argument_count++] = thread_string;
+    server_arguments[server_argument_count++] = "--pin-base";
+    server_arguments[server_argument_count++] = server_pin_string;
+    if (echo_enabled)
+    {
+        server_arguments[server_argument_count++] = "--echo";
+    }
+    if (sweep_job->service_nanoseconds > 0)
+    {
+        server_arguments[server_argument_count++] = "--work";
+        server_arguments[server_argument_count++] = work_kind_string;
+        server_arguments[server_argument_count++] = "--work-ns";
+        server_arguments[server_argument_count++] = service_string;
+        server_arguments[server_argument_count++] = "--work-bytes";
+        server_arguments[server_argument_count++] = work_bytes_string;
+        server_arguments[server_argument_count++] = "--work-pool";
+        server_arguments[server_argument_count++] = work_pool_string;
+    }
+    server_arguments[server_argument_count] = NULL;
+
+    char *client_arguments[24];
+    int client_argument_count = 0;
+    client_arguments[client_argument_count++] = client_path;
+    client_arguments[client_argument_count++] = "--host";
+    client_arguments[client_argument_count++] = (char *)sweep_config->host_address;
+    client_arguments[client_argument_count++] = "--port";
+    client_arguments[client_argument_count++] = port_string;
+    client_arguments[client_argument_count++] = "--msg-size";
+    client_arguments[client_argument_count++] = size_string;
+    client_arguments[client_argument_count++] = "--threads";
+    client_arguments[client_argument_count++] = thread_string;
+    client_arguments[client_argument_count++] = "--duration";
+    client_arguments[client_argument_count++] = duration_string;
+    client_arguments[client_argument_count++] = "--mode";
+    client_arguments[client_argument_count++] = sweep_job->latency_mode ? "latency" : "throughput";
+    client_arguments[client_argument_count++] = "--pin-base";
+    client_arguments[client_argument_count++] = client_pin_string;
+    client_arguments[client_argument_count++] = "--zc-inflight";
+    client_arguments[client_argument_count++] = inflight_string;
+    if (echo_enabled)
+    {
+        client_arguments[client_argument_count++] = "--echo";
+    }
+    client_arguments[client_argument_count] = NULL;
+
+    pid_t server_pid = spawn_process(server_arguments, -1);
+    if (server_pid < 0)
+    {
+        return -1;
+    }
+    struct timespec start_delay = {0, SWEEP_SERVER_START_WAIT_MS * 1000000L};
+    nanosleep(&start_delay, NULL);
+
+    int output_pipe[2];
+    if (pipe(output_pipe) != 0)
+    {
+        kill(server_pid, SIGKILL);
+        waitpid(server_pid, NULL, 0);
+        return -1;
+    }
+    pid_t client_pid = spawn_process(client_arguments, output_pipe[1]);
+    close(output_pipe[1]);
+    char client_output[SWEEP_MAX_OUTPUT];
+    size_t output_length = 0;
+    ssize_t read_result;
+    while ((read_result = read(output_pipe[0], client_output + output_length, sizeof(client_output) - 1 - output_length)) > 0)
+    {
+        output_length += (size_t)read_result;
+        if (output_length >= sizeof(client_output) - 1)
+        {
+            break;
+        }
+    }
+    client_output[output_length] = '\0';
+    close(output_pipe[0]);
+    int client_status = (client_pid > 0) ? wait_for_child(client_pid, (int)(duration_seconds * 1000.0) + 30000) : -1;
+    wait_for_child(server_pid, SWEEP_SERVER_EXIT_WAIT_MS);
+    if (client_status != 0)
+    {
+        return -1;
+    }
+
+    memset(trial_ptr, 0, sizeof(*trial_ptr));
+    int result_found = 0;
+    char *line_pointer = strtok(client_output, "\n");
+    while (line_pointer)
+    {
+        if (!result_found && sscanf(line_pointer, "RESULT,%lf,%lf", &trial_ptr->throughput_gbps, &trial_ptr->latency_microseconds) == 2)
+        {
+            result_found = 1;
+        }
+        else
+        {
+            sscanf(line_pointer, "LATENCY_PERCENTILES,%lf,%*f,%lf", &trial_ptr->p50_microseconds, &trial_ptr->p99_microseconds);
+        }
+        line_pointer = strtok(NULL, "\n");
+    }
+    if (!result_found || (sweep_job->latency_mode ? trial_ptr->latency_microseconds : trial_ptr->throughput_gbps) <= 0.0)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+static int run_trial_with_retries(const sweep_config_t *sweep_config, const sweep_job_t *sweep_job, double duration_seconds, sweep_trial_t *trial_ptr)
+{
+    for (int attempt_index = 0; attempt_index < SWEEP_MAX_TRIAL_ATTEMPTS; attempt_index++)
+    {
+        if (run_trial(sweep_config, sweep_job, duration_seconds, trial_ptr) == 0)
+        {
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static double trial_primary_metric(const sweep_job_t *sweep_job, const sweep_trial_t *trial_ptr)
+{
+    return sweep_job->latency_mode ? trial_ptr->latency_microseconds : trial_ptr->throughput_gbps;
+}
+
+static int run_job(const sweep_config_t *sweep_config, sweep_job_t *sweep_job)
+{
+    sweep_trial_t current_trial;
+    double previous_metric = 0.0;
+    int warmup_trial_count = 0;
+    int warmup_converged = 0;
+    while (warmup_trial_count < sweep_config->maximum_warmup_trials)
+    {
+        if (run_trial_with_retries(sweep_config, sweep_job, sweep_config->warmup_seconds, &current_trial) != 0)
+        {
+            return -1;
+        }
+        double current_metric = trial_primary_metric(sweep_job, &current_trial);
+        warmup_trial_count++;
+        if (warmup_trial_count > 1 && fabs(current_metric - previous_metric) <= sweep_config->warmup_tolerance * previous_metric)
+        {
+            warmup_converged = 1;
+            break;
+        }
+        previous_metric = current_metric;
+    }
+
+    double throughput_samples[SWEEP_MAX_VALUES * 4];
+    double latency_samples[SWEEP_MAX_VALUES * 4];
+    double p50_samples[SWEEP_MAX_VALUES * 4];
+    double p99_samples[SWEEP_MAX_VALUES * 4];
+    int maximum_trials = sweep_config->maximum_trials < SWEEP_MAX_VALUES * 4 ? sweep_config->maximum_trials : SWEEP_MAX_VALUES * 4;
+    int trial_count = 0;
+    double throughput_mean = 0.0, throughput_half_width = 0.0;
+    double latency_mean = 0.0, latency_half_width = 0.0;
+    int confidence_met = 0;
+    while (trial_count < maximum_trials)
+    {
+        if (run_trial_with_retries(sweep_config, sweep_job, sweep_config->duration_seconds, &current_trial) != 0)
+        {
+            return -1;
+        }
+        throughput_samples[trial_count] = current_trial.throughput_gbps;
+        latency_samples[trial_count] = current_trial.latency_microseconds;
+        p50_samples[trial_count] = current_trial.p50_microseconds;
+        p99_samples[trial_count] = current_trial.p99_microseconds;
+        trial_count++;
+        sample_statistics(throughput_samples, trial_count, &throughput_mean, &throughput_half_width);
+        sample_statistics(latency_samples, trial_count, &latency_mean, &latency_half_width);
+        double primary_mean = sweep_job->latency_mode ? latency_mean : throughput_mean;
+        double primary_half_width = sweep_job->latency_mode ? latency_half_width : throughput_half_width;
+        if (trial_count >= sweep_config->minimum_trials && primary_mean > 0.0 &&
+            primary_half_width <= sweep_config->confidence_target * primary_mean)
+        {
+            confidence_met = 1;
+            break;
+        }
+    }
+    double p50_mean = 0.0, p99_mean = 0.0, unused_half_width = 0.0;
+    sample_statistics(p50_samples, trial_count, &p50_mean, &unused_half_width);
+    sample_statistics(p99_samples, trial_count, &p99_mean, &unused_half_width);
+
+    snprintf(sweep_job->result_row, sizeof(sweep_job->result_row),
+             "%s,%d,%d,%s,%d,%d,%d,%d,%d,%.6f,%.6f,%.3f,%.3f,%.3f,%.3f\n",
+             sweep_job->implementation_name, sweep_job->message_size, sweep_job->thread_count,
+             sweep_job->latency_mode ? "latency" : "throughput", sweep_job->service_nanoseconds,
+             trial_count, warmup_trial_count, warmup_converged, confidence_met,
+             throughput_mean, throughput_half_width, latency_mean, latency_half_width, p50_mean, p99_mean);
+    return 0;
+}
+
+static int find_free_cores(const int *core_busy_array, int online_cpu_count, int core_count)
+{
+    for (int first_core = 0; first_core + core_count <= online_cpu_count; first_core++)
+    {
+        int range_free = 1;
+        for (int core_index = first_core; core_index < first_core + core_count; core_index++)
+        {
+            if (core_busy_array[core_index])
+            {
+                range_free = 0;
+                break;
+            }
+        }
+        if (range_free)
+        {
+            return first_core;
+        }
+    }
+    return -1;
+}
+
+static int compare_with_baseline(const sweep_config_t *sweep_config, const char *baseline_path, sweep_job_t *job_array, int job_count)
+{
+    FILE *baseline_file = fopen(baseline_path, "r");
+    if (!baseline_file)
+    {
+        perror(baseline_path);
+        return -1;
+    }
+    int regression_count = 0;
+    int compared_count = 0;
+    char baseline_line[512];
+    while (fgets(baseline_line, sizeof(baseline_line), baseline_file))
+    {
+        char implementation_name[8], mode_name[16];
+        int message_size, thread_count, service_nanoseconds;
+        double baseline_throughput, baseline_throughput_ci, baseline_p99;
+        if (sscanf(baseline_line, "%7[^,],%d,%d,%15[^,],%d,%*d,%*d,%*d,%*d,%lf,%lf,%*f,%*f,%*f,%lf",
+                   implementation_name, &message_size, &thread_count, mode_name, &service_nanoseconds,
+                   &baseline_throughput, &baseline_throughput_ci, &baseline_p99) != 8)
+        {
+            continue;
+        }
+        for (int job_index = 0; job_index < job_count; job_index++)
+        {
+            sweep_job_t *sweep_job = &job_array[job_index];
+            if (strcmp(sweep_job->implementation_name, implementation_name) != 0 || sweep_job->message_size != message_size ||
+                sweep_job->thread_count != thread_count || strcmp(sweep_job->latency_mode ? "latency" : "throughput", mode_name) != 0 ||
+                sweep_job->service_nanoseconds != service_nanoseconds || !sweep_job->result_row[0])
+            {
+                continue;
+            }
+            double current_throughput = 0.0, current_p99 = 0.0;
+            sscanf(sweep_job->result_row, "%*[^,],%*d,%*d,%*[^,],%*d,%*d,%*d,%*d,%*d,%lf,%*f,%*f,%*f,%*f,%lf", &current_throughput, &current_p99);
+            compared_count++;
+            if (!sweep_job->latency_mode && baseline_throughput > 0.0 &&
+                current_throughput < baseline_throughput * (1.0 - sweep_config->throughput_regression_threshold))
+            {
+                printf("REGRESSION,throughput,%s,%d,%d,%s,%d,%.6f,%.6f,%.2f%%\n", implementation_name, message_size, thread_count, mode_name,
+                       service_nanoseconds, baseline_throughput, current_throughput, 100.0 * (current_throughput / baseline_throughput - 1.0));
+                regression_count++;
+            }
+            if (sweep_job->latency_mode && baseline_p99 > 0.0 &&
+                current_p99 > baseline_p99 * (1.0 + sweep_config->p99_regression_threshold))
+            {
+                printf("REGRESSION,p99,%s,%d,%d,%s,%d,%.3f,%.3f,%.2f%%\n", implementation_name, message_size, thread_count, mode_name,
+                       service_nanoseconds, baseline_p99, current_p99, 100.0 * (current_p99 / baseline_p99 - 1.0));
+                regression_count++;
+            }
+        }
+    }
+    int read_failed = ferror(baseline_file);
+    fclose(baseline_file);
+    if (read_failed)
+    {
+        fprintf(stderr, "%s: read error\n", baseline_path);
+        return -1;
+    }
+    printf("BASELINE,%d,%d\n", compared_count, regression_count);
+    return regression_count;
+}
+
+static void usage_sweep(const char *program_name)
+{
+    fprintf(stderr, "Usage: %s [--config file.json] [--out results.csv] [--baseline baseline.csv] [--max-parallel n]\n", program_name);
+}
+
+int main(int argument_count, char **argument_values)
+{
+    const char *config_path = "MT25041_Part_C_Config.json";
+    const char *output_path = "MT25041_Part_B_SweepData.csv";
+    const char *baseline_path = NULL;
+    int parallel_override = -1;
+    for (int arg_index = 1; arg_index < argument_count; arg_index++)
+    {
+        if (strcmp(argument_values[arg_index], "--config") == 0 && arg_index + 1 < argument_count)
+        {
+            config_path = argument_values[++arg_index];
+        }
+        else if (strcmp(argument_values[arg_index], "--out") == 0 && arg_index + 1 < argument_count)
+        {
+            output_path = argument_values[++arg_index];
+        }
+        else if (strcmp(argument_values[arg_index], "--baseline") == 0 && arg_index + 1 < argument_count)
+        {
+            baseline_path = argument_values[++arg_index];
+        }
+        else if (strcmp(argument_values[arg_index], "--max-parallel") == 0 && arg_index + 1 < argument_count)
+        {
+            parallel_override = atoi(argument_values[++arg_index]);
+        }
+        else
+        {
+            usage_sweep(argument_values[0]);
+            return 1;
+        }
+    }
+
+    sweep_config_t sweep_config;
+    memset(&sweep_config, 0, sizeof(sweep_config));
+    if (load_sweep_config(config_path, &sweep_config) != 0)
+    {
+        return 1;
+    }
+    if (parallel_override >= 0)
+    {
+        sweep_config.maximum_parallel_jobs = parallel_override;
+    }
+    char executable_path[PATH_MAX];
+    snprintf(executable_path, sizeof(executable_path), "%s", argument_values[0]);
+    char *resolved_directory = realpath(dirname(executable_path), NULL);
+    snprintf(sweep_config.binary_directory, sizeof(sweep_config.binary_directory), "%s", resolved_directory ? resolved_directory : ".");
+    free(resolved_directory);
+
+    static const char *implementation_names[] = {"A1", "A2", "A3"};
+    int job_count = 3 * sweep_config.message_size_count * sweep_config.thread_count_count * sweep_config.service_nanosecond_count * 2;
+    sweep_job_t *job_array = (sweep_job_t *)calloc((size_t)job_count, sizeof(sweep_job_t));
+    if (!job_array)
+    {
+        return 1;
+    }
+    int online_cpu_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (online_cpu_count < 1)
+    {
+        online_cpu_count = 1;
+    }
+    int job_index = 0;
+    for (int implementation_index = 0; implementation_index < 3; implementation_index++)
+    {
+        for (int size_index = 0; size_index < sweep_config.message_size_count; size_index++)
+        {
+            for (int thread_index = 0; thread_index < sweep_config.thread_count_count; thread_index++)
+            {
+                for (int service_index = 0; service_index < sweep_config.service_nanosecond_count; service_index++)
+                {
+                    for (int latency_mode = 0; latency_mode < 2; latency_mode++)
+                    {
+                        sweep_job_t *sweep_job = &job_array[job_index++];
+                        snprintf(sweep_job->implementation_name, sizeof(sweep_job->implementation_name), "%s", implementation_names[implementation_index]);
+                        sweep_job->message_size = sweep_config.message_sizes[size_index];
+                        sweep_job->thread_count = sweep_config.thread_counts[thread_index];
+                        sweep_job->service_nanoseconds = sweep_config.service_nanoseconds[service_index];
+                        sweep_job->latency_mode = latency_mode;
+                        sweep_job->core_count = 2 * sweep_job->thread_count;
+                        sweep_job->runner_pid = 0;
+                        sweep_job->result_pipe_fd = -1;
+                    }
+                }
+            }
+        }
+    }
+
+    int *core_busy_array = (int *)calloc((size_t)online_cpu_count, sizeof(int));
+    int *port_busy_array = (int *)calloc((size_t)job_count, sizeof(int));
+    if (!core_busy_array || !port_busy_array)
+    {
+        return 1;
+    }
+    int next_job_index = 0;
+    int running_job_count = 0;
+    int failed_job_count = 0;
+    int completed_job_count = 0;
+    uint64_t sweep_start_time_ns = now_ns();
+    while (next_job_index < job_count || running_job_count > 0)
+    {
+        while (next_job_index < job_count &&
+               (sweep_config.maximum_parallel_jobs <= 0 || running_job_count < sweep_config.maximum_parallel_jobs))
+        {
+            sweep_job_t *sweep_job = &job_array[next_job_index];
+            int exclusive_job = sweep_job->core_count > online_cpu_count;
+            if (exclusive_job && running_job_count > 0)
+            {
+                break;
+            }
+            int first_core = exclusive_job ? -1 : find_free_cores(core_busy_array, online_cpu_count, sweep_job->core_count);
+            if (!exclusive_job && first_core < 0)
+            {
+                break;
+            }
+            int port_slot = 0;
+            while (port_busy_array[port_slot])
+            {
+                port_slot++;
+            }
+            sweep_job->first_core = first_core;
+            sweep_job->port_number = sweep_config.base_port + port_slot;
+            port_busy_array[port_slot] = 1;
+            for (int core_index = 0; core_index < (exclusive_job ? online_cpu_count : sweep_job->core_count); core_index++)
+            {
+                core_busy_array[(exclusive_job ? 0 : first_core) + core_index] = 1;
+            }
+
+            int result_pipe[2];
+            if (pipe(result_pipe) != 0)
+            {
+                perror("pipe");
+                return 1;
+            }
+            fflush(stdout);
+            pid_t runner_pid = fork();
+            if (runner_pid == 0)
+            {
+                close(result_pipe[0]);
+                int job_status = run_job(&sweep_config, sweep_job);
+                if (job_status == 0 && write(result_pipe[1], sweep_job->result_row, strlen(sweep_job->result_row)) < 0)
+                {
+                    job_status = -1;
+                }
+                _exit(job_status == 0 ? 0 : 1);
+            }
+            close(result_pipe[1]);
+            sweep_job->runner_pid = runner_pid;
+            sweep_job->result_pipe_fd = result_pipe[0];
+            running_job_count++;
+            next_job_index++;
+            fprintf(stderr, "Started %d/%d: %s size=%d threads=%d service=%dns mode=%s cores=%d-%d port=%d\n",
+                    next_job_index, job_count, sweep_job->implementation_name, sweep_job->message_size, sweep_job->thread_count,
+                    sweep_job->service_nanoseconds, sweep_job->latency_mode ? "latency" : "throughput",
+                    first_core, first_core < 0 ? -1 : first_core + sweep_job->core_count - 1, sweep_job->port_number);
+        }
+
+        int runner_status = 0;
+        pid_t finished_pid = waitpid(-1, &runner_status, 0);
+        if (finished_pid < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        for (int search_index = 0; search_index < next_job_index; search_index++)
+        {
+            sweep_job_t *sweep_job = &job_array[search_index];
+            if (sweep_job->runner_pid != finished_pid)
+            {
+                continue;
+            }
+            ssize_t row_length = read(sweep_job->result_pipe_fd, sweep_job->result_row, sizeof(sweep_job->result_row) - 1);
+            sweep_job->result_row[row_length > 0 ? row_length : 0] = '\0';
+            close(sweep_job->result_pipe_fd);
+            sweep_job->runner_pid = 0;
+            port_busy_array[sweep_job->port_number - sweep_config.base_port] = 0;
+            int exclusive_job = sweep_job->first_core < 0;
+            for (int core_index = 0; core_index < (exclusive_job ? online_cpu_count : sweep_job->core_count); core_index++)
+            {
+                core_busy_array[(exclusive_job ? 0 : sweep_job->first_core) + core_index] = 0;
+            }
+            running_job_count--;
+            completed_job_count++;
+            if (!WIFEXITED(runner_status) || WEXITSTATUS(runner_status) != 0 || !sweep_job->result_row[0])
+            {
+                failed_job_count++;
+                sweep_job->result_row[0] = '\0';
+                fprintf(stderr, "Failed: %s size=%d threads=%d service=%dns mode=%s\n", sweep_job->implementation_name, sweep_job->message_size,
+                        sweep_job->thread_count, sweep_job->service_nanoseconds, sweep_job->latency_mode ? "latency" : "throughput");
+            }
+            else
+            {
+                fprintf(stderr, "Done %d/%d: %s", completed_job_count, job_count, sweep_job->result_row);
+            }
+            break;
+        }
+    }
+
+    FILE *output_file = fopen(output_path, "w");
+    if (!output_file)
+    {
+        perror(output_path);
+        return 1;
+    }
+    fprintf(output_file, "impl,msg_size,threads,mode,service_ns,trials,warmup_trials,warmup_converged,ci_met,"
+                         "throughput_gbps,throughput_ci95,latency_us,latency_ci95,p50_us,p99_us\n");
+    for (job_index = 0; job_index < job_count; job_index++)
+    {
+        fputs(job_array[job_index].result_row, output_file);
+    }
+    fclose(output_file);
+    printf("SWEEP,%d,%d,%.1f,%s\n", job_count, failed_job_count, (double)(now_ns() - sweep_start_time_ns) / 1e9, output_path);
+
+    int exit_status = failed_job_count ? 1 : 0;
+    if (baseline_path)
+    {
+        int regression_count = compare_with_baseline(&sweep_config, baseline_path, job_array, job_count);
+        if (regression_count < 0)
+        {
+            exit_status = 1;
+        }
+        else if (regression_count > 0)
+        {
+            exit_status = 2;
+        }
+    }
+    free(core_busy_array);
+    free(port_busy_array);
+    free(job_array);
+    return exit_status;
+}
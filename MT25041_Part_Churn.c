@@ -0,0 +1,218 @@
+#include "MT25041_Part_Common.h"
+
+#define CHURN_CONNECT_RETRY_NANOSECONDS 1000000L
+#define CHURN_SESSION_CONNECT_FAILED -1
+#define CHURN_SESSION_IO_FAILED -2
+
+typedef struct
+{
+    int thread_index;
+    const client_config_t *client_config;
+    enum send_mode send_operation_mode;
+    uint64_t session_count;
+    uint64_t failed_connect_count;
+    uint64_t failed_session_count;
+    uint64_t total_bytes_sent;
+    uint64_t message_count;
+    uint64_t round_trip_time_nanoseconds_sum;
+    uint64_t elapsed_nanoseconds;
+    latency_histogram_t connect_histogram;
+    latency_histogram_t first_byte_histogram;
+    latency_histogram_t round_trip_histogram;
+} churn_thread_context_t;
+
+static int churn_send_message(churn_thread_context_t *thread_context, int socket_file_descriptor, message_t *current_message, char *send_packed_buffer)
+{
+    size_t message_size = thread_context->client_config->message_size;
+    if (thread_context->send_operation_mode == SEND_BASELINE)
+    {
+        message_pack(current_message, send_packed_buffer);
+        return write_full(socket_file_descriptor, send_packed_buffer, message_size);
+    }
+    struct iovec io_vector_array[FIELD_COUNT];
+    message_iov(current_message, io_vector_array);
+    return sendmsg_full(socket_file_descriptor, io_vector_array, FIELD_COUNT, MSG_NOSIGNAL);
+}
+
+static int churn_run_session(churn_thread_context_t *thread_context, message_t *current_message, char *send_packed_buffer, char *receive_buffer)
+{
+    const client_config_t *client_config = thread_context->client_config;
+    int connect_options = client_config->fastopen_enabled ? CONNECT_OPTION_FASTOPEN : 0;
+
+    uint64_t session_start_time_ns = now_ns();
+    int socket_file_descriptor = create_client_socket_with_options(client_config->hostname, client_config->port_number, connect_options);
+    if (socket_file_descriptor < 0)
+    {
+        return CHURN_SESSION_CONNECT_FAILED;
+    }
+    latency_histogram_record(&thread_context->connect_histogram, now_ns() - session_start_time_ns);
+
+    int session_status = 0;
+    for (int message_index = 0; message_index < client_config->churn_session_messages; message_index++)
+    {
+        uint64_t message_send_start_time_ns = now_ns();
+        if (churn_send_message(thread_context, socket_file_descriptor, current_message, send_packed_buffer) <= 0)
+        {
+            session_status = CHURN_SESSION_IO_FAILED;
+            break;
+        }
+        thread_context->total_bytes_sent += client_config->message_size;
+        thread_context->message_count++;
+
+        if (client_config->enable_echo)
+        {
+            size_t bytes_already_received = 0;
+            if (message_index == 0)
+            {
+                ssize_t receive_result = recv(socket_file_descriptor, receive_buffer, client_config->message_size, 0);
+                if (receive_result <= 0)
+                {
+                    session_status = CHURN_SESSION_IO_FAILED;
+                    break;
+                }
+                latency_histogram_record(&thread_context->first_byte_histogram, now_ns() - session_start_time_ns);
+                bytes_already_received = (size_t)receive_result;
+            }
+            if (bytes_already_received < client_config->message_size &&
+                read_full(socket_file_descriptor, receive_buffer + bytes_already_received, client_config->message_size - bytes_already_received) <= 0)
+            {
+                session_status = CHURN_SESSION_IO_FAILED;
+                break;
+            }
+        }
+        if (client_config->operation_mode == MODE_LATENCY)
+        {
+            uint64_t message_round_trip_ns = now_ns() - message_send_start_time_ns;
+            thread_context->round_trip_time_nanoseconds_sum += message_round_trip_ns;
+            latency_histogram_record(&thread_context->round_trip_histogram, message_round_trip_ns);
+        }
+    }
+    close(socket_file_descriptor);
+    return session_status;
+}
+
+static void *churn_thread_main(void *thread_argument)
+{
+    churn_thread_context_t *thread_context = (churn_thread_context_t *)thread_argument;
+    const client_config_t *client_config = thread_context->client_config;
+    if (client_config->cpu_pin_base >= 0)
+    {
+        pin_thread(client_config->cpu_pin_base + thread_context->thread_index);
+    }
+
+    message_t current_message;
+    message_init(&current_message, client_config->message_size);
+    char *send_packed_buffer = (char *)malloc(client_config->message_size);
+    char *receive_buffer = (char *)malloc(client_config->message_size);
+    if (!send_packed_buffer || !receive_buffer)
+    {
+        message_free(&current_message);
+        free(send_packed_buffer);
+        free(receive_buffer);
+        return NULL;
+    }
+
+    uint64_t operation_start_time_ns = now_ns();
+    while (now_ns() - operation_start_time_ns < (uint64_t)client_config->duration_seconds * 1000000000ULL)
+    {
+        int session_status = churn_run_session(thread_context, &current_message, send_packed_buffer, receive_buffer);
+        if (session_status != 0)
+        {
+            if (session_status == CHURN_SESSION_CONNECT_FAILED)
+            {
+                thread_context->failed_connect_count++;
+            }
+            else
+            {
+                thread_context->failed_session_count++;
+            }
+            struct timespec retry_delay = {0, CHURN_CONNECT_RETRY_NANOSECONDS};
+            nanosleep(&retry_delay, NULL);
+            continue;
+        }
+        thread_context->session_count++;
+    }
+    thread_context->elapsed_nanoseconds = now_ns() - operation_start_time_ns;
+
+    message_free(&current_message);
+    free(send_packed_buffer);
+    free(receive_buffer);
+    return NULL;
+}
+
+int run_churn_client(const client_config_t *client_config, enum send_mode send_operation_mode)
+{
+    if (send_operation_mode == SEND_ZEROCOPY)
+    {
+        send_operation_mode = SEND_SENDMSG;
+    }
+
+    pthread_t *churn_thread_array = (pthread_t *)calloc((size_t)client_config->thread_count, sizeof(pthread_t));
+    churn_thread_context_t *thread_context_array = (churn_thread_context_t *)calloc((size_t)client_config->thread_count, sizeof(churn_thread_context_t));
+    latency_histogram_t *aggregated_histogram_array = (latency_histogram_t *)calloc(3, sizeof(latency_histogram_t));
+    if (!churn_thread_array || !thread_context_array || !aggregated_histogram_array)
+    {
+        free(churn_thread_array);
+        free(thread_context_array);
+        free(aggregated_histogram_array);
+        return 1;
+    }
+
+    for (int thread_index = 0; thread_index < client_config->thread_count; thread_index++)
+    {
+        thread_context_array[thread_index].thread_index = thread_index;
+        thread_context_array[thread_index].client_config = client_config;
+        thread_context_array[thread_index].send_operation_mode = send_operation_mode;
+        pthread_create(&churn_thread_array[thread_index], NULL, churn_thread_main, &thread_context_array[thread_index]);
+    }
+
+    uint64_t aggregated_session_count = 0;
+    uint64_t aggregated_failed_connect_count = 0;
+    uint64_t aggregated_failed_session_count = 0;
+    uint64_t aggregated_total_bytes = 0;
+    uint64_t aggregated_total_messages = 0;
+    uint64_t aggregated_round_trip_time_ns = 0;
+    uint64_t maximum_elapsed_nanoseconds = 0;
+    for (int thread_index = 0; thread_index < client_config->thread_count; thread_index++)
+    {
+        churn_thread_context_t *thread_context = &thread_context_array[thread_index];
+        pthread_join(churn_thread_array[thread_index], NULL);
+        aggregated_session_count += thread_context->session_count;
+        aggregated_failed_connect_count += thread_context->failed_connect_count;
+        aggregated_failed_session_count += thread_context->failed_session_count;
+        aggregated_total_bytes += thread_context->total_bytes_sent;
+        aggregated_total_messages += thread_context->message_count;
+        aggregated_round_trip_time_ns += thread_context->round_trip_time_nanoseconds_sum;
+        if (thread_context->elapsed_nanoseconds > maximum_elapsed_nanoseconds)
+        {
+            maximum_elapsed_nanoseconds = thread_context->elapsed_nanoseconds;
+        }
+        latency_histogram_merge(&aggregated_histogram_array[0], &thread_context->connect_histogram);
+        latency_histogram_merge(&aggregated_histogram_array[1], &thread_context->first_byte_histogram);
+        latency_histogram_merge(&aggregated_histogram_array[2], &thread_context->round_trip_histogram);
+    }
+
+    double elapsed_time_seconds = (double)maximum_elapsed_nanoseconds / 1e9;
+    report_result(client_config->operation_mode, aggregated_total_bytes, aggregated_total_messages, aggregated_round_trip_time_ns, maximum_elapsed_nanoseconds);
+    printf("CHURN,%d,%d,%llu,%.1f,%llu,%llu\n",
+           client_config->thread_count,
+           client_config->churn_session_messages,
+           (unsigned long long)aggregated_session_count,
+           elapsed_time_seconds > 0.0 ? (double)aggregated_session_count / elapsed_time_seconds : 0.0,
+           (unsigned long long)aggregated_failed_connect_count,
+           (unsigned long long)aggregated_failed_session_count);
+    report_latency_percentiles("CONNECT_PERCENTILES", &aggregated_histogram_array[0]);
+    if (client_config->enable_echo)
+    {
+        report_latency_percentiles("TTFB_PERCENTILES", &aggregated_histogram_array[1]);
+    }
+    if (client_config->operation_mode == MODE_LATENCY)
+    {
+        report_latency_percentiles("LATENCY_PERCENTILES", &aggregated_histogram_array[2]);
+    }
+
+    free(aggregated_histogram_array);
+    free(churn_thread_array);
+    free(thread_context_array);
+    return 0;
+}
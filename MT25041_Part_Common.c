@@ -1,28 +1,5 @@
 #include "MT25041_Part_Common.h"
 
-typedef struct
-{
-    char bind_ip_address[64];
-    int port_number;
-    size_t message_size;
-    int maximum_clients;
-    int enable_echo;
-    int cpu_pin_base;
-} server_config_t;
-
-typedef struct
-{
-    char hostname[64];
-    int port_number;
-    size_t message_size;
-    int thread_count;
-    int duration_seconds;
-    enum run_mode operation_mode;
-    int enable_echo;
-    int cpu_pin_base;
-    int zerocopy_inflight_limit;
-} client_config_t;
-
 typedef struct
 {
     int socket_file_descriptor;
@@ -30,34 +7,28 @@ typedef struct
     int enable_echo;
     int thread_index;
     int cpu_pin_base;
+    const server_config_t *server_config;
+    server_work_pool_t *work_pool_ptr;
+    kernel_sampler_t *kernel_sampler_ptr;
+    latency_histogram_t service_histogram;
+    transport_receiver_t transport_receiver;
 } server_thread_context_t;
 
+typedef struct
+{
+    const server_config_t *server_config;
+    server_work_scratch_t work_scratch;
+} server_work_handler_context_t;
+
 typedef struct
 {
     int thread_index;
-    int socket_file_descriptor;
-    size_t message_size;
-    int duration_seconds;
-    enum run_mode operation_mode;
-    int enable_echo;
-    enum send_mode send_operation_mode;
     int cpu_pin_base;
-    int zerocopy_inflight_limit;
-    int zerocopy_enabled;
-    uint64_t total_bytes_sent;
-    uint64_t message_count;
-    uint64_t round_trip_time_nanoseconds_sum;
-    uint64_t elapsed_nanoseconds;
+    transport_send_loop_t send_loop;
+    transport_sender_t transport_sender;
 } client_thread_context_t;
 
-static uint64_t now_ns(void)
-{
-    struct timespec timestamp;
-    clock_gettime(CLOCK_MONOTONIC, &timestamp);
-    return (uint64_t)timestamp.tv_sec * 1000000000ULL + (uint64_t)timestamp.tv_nsec;
-}
-
-static size_t parse_size(const char *size_string)
+size_t parse_size(const char *size_string)
 {
     char *end_pointer = NULL;
     unsigned long long parsed_value = strtoull(size_string, &end_pointer, 10);
@@ -80,312 +51,374 @@ static size_t parse_size(const char *size_string)
     return (size_t)parsed_value;
 }
 
-static int pin_thread(int cpu_core_id)
+static void server_work_handle_message(void *handler_context, char *payload_buffer, size_t payload_length)
 {
-    if (cpu_core_id < 0)
-    {
-        return 0;
-    }
-    cpu_set_t cpu_affinity_set;
-    CPU_ZERO(&cpu_affinity_set);
-    CPU_SET(cpu_core_id, &cpu_affinity_set);
-    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_affinity_set), &cpu_affinity_set);
+    server_work_handler_context_t *work_handler_context = (server_work_handler_context_t *)handler_context;
+    server_work_execute(work_handler_context->server_config, &work_handler_context->work_scratch, payload_buffer, payload_length);
 }
 
-static int set_common_sockopts(int socket_file_descriptor)
+static void report_ktls_failure(void)
 {
-    int enable_option = 1;
-    if (setsockopt(socket_file_descriptor, IPPROTO_TCP, TCP_NODELAY, &enable_option, sizeof(enable_option)) != 0)
+    if (errno == ENOENT)
     {
-        return -1;
+        fprintf(stderr, "ktls: the tls ULP is not available, load it with 'modprobe tls'\n");
+        return;
     }
-    return 0;
+    perror("ktls");
 }
 
-static int read_full(int socket_file_descriptor, void *buffer, size_t buffer_length)
+static void server_thread_close_socket(server_thread_context_t *thread_context)
 {
-    size_t bytes_read_offset = 0;
-    while (bytes_read_offset < buffer_length)
-    {
-        ssize_t receive_result = recv(socket_file_descriptor, (char *)buffer + bytes_read_offset, buffer_length - bytes_read_offset, 0);
-        if (receive_result == 0)
-        {
-            return 0;
-        }
-        if (receive_result < 0)
-        {
-            if (errno == EINTR)
-            {
-                continue;
-            }
-            return -1;
-        }
-        if (receive_result == 0)
-        {
-            return -1;
-        }
-        bytes_read_offset += (size_t)receive_result;
-    }
-    return 1;
+    kernel_sampler_remove_socket(thread_context->kernel_sampler_ptr, thread_context->socket_file_descriptor);
+    close(thread_context->socket_file_descriptor);
 }
 
-static int write_full(int socket_file_descriptor, const void *buffer, size_t buffer_length)
+static void *server_thread_main(void *thread_argument)
 {
-    size_t bytes_written_offset = 0;
-    while (bytes_written_offset < buffer_length)
+    server_thread_context_t *thread_context = (server_thread_context_t *)thread_argument;
+    const server_config_t *server_config = thread_context->server_config;
+    if (thread_context->cpu_pin_base >= 0)
     {
-        ssize_t send_result = send(socket_file_descriptor, (const char *)buffer + bytes_written_offset, buffer_length - bytes_written_offset, MSG_NOSIGNAL);
-        if (send_result < 0)
-        {
-            if (errno == EINTR)
-            {
-                continue;
-            }
-            return -1;
-        }
-        bytes_written_offset += (size_t)send_result;
+        pin_thread(thread_context->cpu_pin_base + thread_context->thread_index);
     }
-    return 1;
-}
-
-static void message_init(message_t *message_ptr, size_t total_size)
-{
-    size_t base_field_size = total_size / FIELD_COUNT;
-    size_t size_remainder = total_size % FIELD_COUNT;
-    message_ptr->total_message_size = total_size;
-    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    if (server_config->tls_enabled && ktls_enable(thread_context->socket_file_descriptor, KTLS_ROLE_SERVER) != 0)
     {
-        size_t current_field_size = base_field_size + ((field_index == FIELD_COUNT - 1) ? size_remainder : 0);
-        message_ptr->field_sizes[field_index] = current_field_size;
-        message_ptr->field_buffers[field_index] = (char *)malloc(current_field_size);
-        if (message_ptr->field_buffers[field_index])
-        {
-            memset(message_ptr->field_buffers[field_index], 'a' + field_index, current_field_size);
-        }
+        report_ktls_failure();
+        server_thread_close_socket(thread_context);
+        return NULL;
     }
-}
-
-static void message_free(message_t *message_ptr)
-{
-    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    if (thread_context->work_pool_ptr)
     {
-        free(message_ptr->field_buffers[field_index]);
-        message_ptr->field_buffers[field_index] = NULL;
-        message_ptr->field_sizes[field_index] = 0;
+        server_work_serve_connection(thread_context->work_pool_ptr, server_config, thread_context->socket_file_descriptor, &thread_context->service_histogram,
+                                     &thread_context->transport_receiver.total_bytes_received);
+        server_thread_close_socket(thread_context);
+        return NULL;
     }
-    message_ptr->total_message_size = 0;
-}
 
-static void message_pack(const message_t *message_ptr, char *destination_buffer)
-{
-    size_t buffer_offset = 0;
-    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    server_work_handler_context_t work_handler_context;
+    work_handler_context.server_config = server_config;
+    if (server_work_scratch_init(&work_handler_context.work_scratch, server_config) != 0)
     {
-        memcpy(destination_buffer + buffer_offset, message_ptr->field_buffers[field_index], message_ptr->field_sizes[field_index]);
-        buffer_offset += message_ptr->field_sizes[field_index];
+        server_thread_close_socket(thread_context);
+        return NULL;
     }
-}
 
-static void message_iov(const message_t *message_ptr, struct iovec *io_vector_array)
-{
-    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    int policy_flags = thread_context->enable_echo ? TRANSPORT_POLICY_ECHO : 0;
+    if (server_config->work_kind != WORK_NONE)
+    {
+        policy_flags |= TRANSPORT_POLICY_MESSAGE_HANDLER | TRANSPORT_POLICY_LATENCY_TIMING;
+    }
+    transport_receiver_t *transport_receiver_ptr = &thread_context->transport_receiver;
+    transport_receiver_ptr->socket_file_descriptor = thread_context->socket_file_descriptor;
+    transport_receiver_ptr->message_size = thread_context->message_size;
+    transport_receiver_ptr->message_handler = server_work_handle_message;
+    transport_receiver_ptr->handler_context = &work_handler_context;
+    transport_receiver_ptr->service_histogram_ptr = &thread_context->service_histogram;
+    transport_receive_loop_t receive_loop = transport_select_receive_loop(server_config->receive_policy, policy_flags);
+    if (receive_loop)
     {
-        io_vector_array[field_index].iov_base = message_ptr->field_buffers[field_index];
-        io_vector_array[field_index].iov_len = message_ptr->field_sizes[field_index];
+        receive_loop(transport_receiver_ptr);
     }
+
+    server_work_scratch_free(&work_handler_context.work_scratch);
+    server_thread_close_socket(thread_context);
+    return NULL;
 }
 
-static int sendmsg_full(int socket_file_descriptor, struct iovec *io_vector_array, int iovec_count, int send_flags)
+static int parse_server_args(int argument_count, char **argument_values, server_config_t *server_config)
 {
-    size_t total_bytes_to_send = 0;
-    for (int vector_index = 0; vector_index < iovec_count; vector_index++)
-    {
-        total_bytes_to_send += io_vector_array[vector_index].iov_len;
-    }
-    size_t bytes_sent_total = 0;
-    while (bytes_sent_total < total_bytes_to_send)
+    server_config->bind_ip_address[0] = '\0';
+    server_config->port_number = 5001;
+    server_config->message_size = 1024;
+    server_config->maximum_clients = 1;
+    server_config->enable_echo = 0;
+    server_config->cpu_pin_base = -1;
+    server_config->work_kind = WORK_NONE;
+    server_config->work_nanoseconds = 0;
+    server_config->work_working_set_bytes = 64 * 1024;
+    server_config->work_pool_threads = 0;
+    server_config->work_inflight_limit = 16;
+    server_config->work_completion_batch = 8;
+    server_config->buffer_pool_enabled = 0;
+    server_config->io_thread_count = 0;
+    server_config->churn_enabled = 0;
+    server_config->duration_seconds = 0;
+    server_config->accept_batch_size = 1;
+    server_config->reuseport_enabled = 0;
+    server_config->fastopen_enabled = 0;
+    server_config->receive_policy = TRANSPORT_RECEIVE_COPY;
+    server_config->udp_enabled = 0;
+    server_config->pubsub_subscriber_count = 0;
+    server_config->pubsub_queue_depth = 64;
+    server_config->pubsub_drop_policy = PUBSUB_BLOCK;
+    server_config->pubsub_zerocopy_enabled = 1;
+    server_config->stripe_connection_count = 0;
+    server_config->sample_interval_milliseconds = 0;
+    server_config->tls_enabled = 0;
+
+    for (int arg_index = 1; arg_index < argument_count; arg_index++)
     {
-        struct msghdr message_header;
-        memset(&message_header, 0, sizeof(message_header));
-        message_header.msg_iov = io_vector_array;
-        message_header.msg_iovlen = iovec_count;
-        ssize_t send_result = sendmsg(socket_file_descriptor, &message_header, send_flags);
-        if (send_result < 0)
+        if (strcmp(argument_values[arg_index], "--bind") == 0 && arg_index + 1 < argument_count)
         {
-            if (errno == EINTR)
-            {
-                continue;
-            }
-            return -1;
+            snprintf(server_config->bind_ip_address, sizeof(server_config->bind_ip_address), "%s", argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--port") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->port_number = atoi(argument_values[++arg_index]);
         }
-        bytes_sent_total += (size_t)send_result;
-        size_t bytes_remaining = (size_t)send_result;
-        int current_vector_index = 0;
-        while (current_vector_index < iovec_count && bytes_remaining > 0)
+        else if (strcmp(argument_values[arg_index], "--msg-size") == 0 && arg_index + 1 < argument_count)
         {
-            if (bytes_remaining >= io_vector_array[current_vector_index].iov_len)
+            server_config->message_size = parse_size(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--max-clients") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->maximum_clients = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--echo") == 0)
+        {
+            server_config->enable_echo = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--pin-base") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->cpu_pin_base = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--work") == 0 && arg_index + 1 < argument_count)
+        {
+            if (server_work_parse_kind(argument_values[++arg_index], &server_config->work_kind) != 0)
             {
-                bytes_remaining -= io_vector_array[current_vector_index].iov_len;
-                io_vector_array[current_vector_index].iov_len = 0;
-                current_vector_index++;
+                fprintf(stderr, "unknown work kind: %s\n", argument_values[arg_index]);
+                return -1;
             }
-            else
+        }
+        else if (strcmp(argument_values[arg_index], "--work-ns") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->work_nanoseconds = strtoull(argument_values[++arg_index], NULL, 10);
+        }
+        else if (strcmp(argument_values[arg_index], "--work-bytes") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->work_working_set_bytes = parse_size(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--work-pool") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->work_pool_threads = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--work-inflight") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->work_inflight_limit = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--work-batch") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->work_completion_batch = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--buffer-pool") == 0)
+        {
+            server_config->buffer_pool_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--io-threads") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->io_thread_count = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--churn") == 0)
+        {
+            server_config->churn_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--duration") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->duration_seconds = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--accept-batch") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->accept_batch_size = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--reuseport") == 0)
+        {
+            server_config->reuseport_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--fastopen") == 0)
+        {
+            server_config->fastopen_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--splice") == 0)
+        {
+            server_config->receive_policy = TRANSPORT_RECEIVE_SPLICE;
+        }
+        else if (strcmp(argument_values[arg_index], "--udp") == 0)
+        {
+            server_config->udp_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--pubsub") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->pubsub_subscriber_count = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--sub-queue") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->pubsub_queue_depth = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--sub-policy") == 0 && arg_index + 1 < argument_count)
+        {
+            if (pubsub_parse_drop_policy(argument_values[++arg_index], &server_config->pubsub_drop_policy) != 0)
             {
-                io_vector_array[current_vector_index].iov_base = (char *)io_vector_array[current_vector_index].iov_base + bytes_remaining;
-                io_vector_array[current_vector_index].iov_len -= bytes_remaining;
-                bytes_remaining = 0;
+                fprintf(stderr, "unknown subscriber policy: %s\n", argument_values[arg_index]);
+                return -1;
             }
         }
-        while (iovec_count > 0 && io_vector_array[0].iov_len == 0)
+        else if (strcmp(argument_values[arg_index], "--pubsub-copy") == 0)
+        {
+            server_config->pubsub_zerocopy_enabled = 0;
+        }
+        else if (strcmp(argument_values[arg_index], "--stripe") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->stripe_connection_count = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--sample-ms") == 0 && arg_index + 1 < argument_count)
+        {
+            server_config->sample_interval_milliseconds = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--tls") == 0)
         {
-            io_vector_array++;
-            iovec_count--;
+            server_config->tls_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--help") == 0)
+        {
+            return -1;
         }
     }
-    return 1;
-}
 
-static int create_server_socket(const char *bind_ip_address, int port_number)
-{
-    int listen_socket_fd = socket(AF_INET, SOCK_STREAM, 0);
-    if (listen_socket_fd < 0)
+    if ((server_config->buffer_pool_enabled || server_config->churn_enabled) && server_config->work_pool_threads > 0)
     {
+        fprintf(stderr, "--buffer-pool and --churn run work inline on the event loop and cannot be combined with --work-pool\n");
         return -1;
     }
-    int enable_reuse_option = 1;
-    setsockopt(listen_socket_fd, SOL_SOCKET, SO_REUSEADDR, &enable_reuse_option, sizeof(enable_reuse_option));
-    set_common_sockopts(listen_socket_fd);
-
-    struct sockaddr_in server_address;
-    memset(&server_address, 0, sizeof(server_address));
-    server_address.sin_family = AF_INET;
-    server_address.sin_port = htons((uint16_t)port_number);
-    server_address.sin_addr.s_addr = bind_ip_address[0] ? inet_addr(bind_ip_address) : INADDR_ANY;
-
-    if (bind(listen_socket_fd, (struct sockaddr *)&server_address, sizeof(server_address)) != 0)
+    if (server_config->receive_policy == TRANSPORT_RECEIVE_SPLICE &&
+        (server_config->work_kind != WORK_NONE || server_config->work_pool_threads > 0 || server_config->buffer_pool_enabled || server_config->churn_enabled))
     {
-        close(listen_socket_fd);
+        fprintf(stderr, "--splice keeps payloads in the kernel and cannot be combined with --work, --buffer-pool or --churn\n");
         return -1;
     }
-    if (listen(listen_socket_fd, 128) != 0)
+    if (server_config->udp_enabled &&
+        (server_config->enable_echo || server_config->work_kind != WORK_NONE || server_config->work_pool_threads > 0 || server_config->buffer_pool_enabled ||
+         server_config->churn_enabled || server_config->receive_policy == TRANSPORT_RECEIVE_SPLICE))
     {
-        close(listen_socket_fd);
+        fprintf(stderr, "--udp is a one-way datagram sink and cannot be combined with --echo, --work, --buffer-pool, --churn or --splice\n");
         return -1;
     }
-    return listen_socket_fd;
-}
-
-static int create_client_socket(const char *hostname, int port_number)
-{
-    int client_socket_fd = socket(AF_INET, SOCK_STREAM, 0);
-    if (client_socket_fd < 0)
+    if (server_config->pubsub_subscriber_count > 0 &&
+        (server_config->enable_echo || server_config->work_kind != WORK_NONE || server_config->work_pool_threads > 0 || server_config->buffer_pool_enabled ||
+         server_config->churn_enabled || server_config->udp_enabled || server_config->receive_policy == TRANSPORT_RECEIVE_SPLICE))
     {
+        fprintf(stderr, "--pubsub cannot be combined with --echo, --work, --buffer-pool, --churn, --udp or --splice\n");
         return -1;
     }
-    set_common_sockopts(client_socket_fd);
-
-    struct sockaddr_in server_address;
-    memset(&server_address, 0, sizeof(server_address));
-    server_address.sin_family = AF_INET;
-    server_address.sin_port = htons((uint16_t)port_number);
-    if (inet_pton(AF_INET, hostname, &server_address.sin_addr) != 1)
+    if (server_config->pubsub_subscriber_count > 0 && server_config->message_size < 16)
     {
-        close(client_socket_fd);
+        fprintf(stderr, "--pubsub needs a message size of at least 16 bytes\n");
         return -1;
     }
-    if (connect(client_socket_fd, (struct sockaddr *)&server_address, sizeof(server_address)) != 0)
+    if (server_config->stripe_connection_count > 0 &&
+        (server_config->enable_echo || server_config->work_kind != WORK_NONE || server_config->work_pool_threads > 0 || server_config->buffer_pool_enabled ||
+         server_config->churn_enabled || server_config->udp_enabled || server_config->pubsub_subscriber_count > 0 ||
+         server_config->receive_policy == TRANSPORT_RECEIVE_SPLICE))
     {
-        close(client_socket_fd);
+        fprintf(stderr, "--stripe cannot be combined with --echo, --work, --buffer-pool, --churn, --udp, --pubsub or --splice\n");
         return -1;
     }
-    return client_socket_fd;
-}
-
-static void *server_thread_main(void *thread_argument)
-{
-    server_thread_context_t *thread_context = (server_thread_context_t *)thread_argument;
-    if (thread_context->cpu_pin_base >= 0)
+    if (server_config->sample_interval_milliseconds > 0 &&
+        (server_config->buffer_pool_enabled || server_config->churn_enabled || server_config->udp_enabled ||
+         server_config->pubsub_subscriber_count > 0 || server_config->stripe_connection_count > 0))
     {
-        pin_thread(thread_context->cpu_pin_base + thread_context->thread_index);
+        fprintf(stderr, "--sample-ms samples the thread-per-connection server and cannot be combined with --buffer-pool, --churn, --udp, --pubsub or --stripe\n");
+        return -1;
     }
-    char *receive_buffer = (char *)malloc(thread_context->message_size);
-    if (!receive_buffer)
+    if (server_config->tls_enabled &&
+        (server_config->buffer_pool_enabled || server_config->churn_enabled || server_config->udp_enabled ||
+         server_config->pubsub_subscriber_count > 0 || server_config->stripe_connection_count > 0))
     {
-        close(thread_context->socket_file_descriptor);
-        return NULL;
+        fprintf(stderr, "--tls runs on the thread-per-connection server and cannot be combined with --buffer-pool, --churn, --udp, --pubsub or --stripe\n");
+        return -1;
     }
-
-    while (1)
+    if (server_config->stripe_connection_count > STRIPE_MAXIMUM_CONNECTIONS)
     {
-        int read_result = read_full(thread_context->socket_file_descriptor, receive_buffer, thread_context->message_size);
-        if (read_result <= 0)
-        {
-            break;
-        }
-        if (thread_context->enable_echo)
-        {
-            if (write_full(thread_context->socket_file_descriptor, receive_buffer, thread_context->message_size) <= 0)
-            {
-                break;
-            }
-        }
+        server_config->stripe_connection_count = STRIPE_MAXIMUM_CONNECTIONS;
+    }
+    if (server_config->pubsub_queue_depth < 2)
+    {
+        server_config->pubsub_queue_depth = 2;
+    }
+    if (server_config->accept_batch_size < 1)
+    {
+        server_config->accept_batch_size = 1;
+    }
+    if (server_config->work_pool_threads < 0)
+    {
+        server_config->work_pool_threads = 0;
     }
+    if (server_config->work_inflight_limit < 1)
+    {
+        server_config->work_inflight_limit = 1;
+    }
+    if (server_config->work_completion_batch < 1)
+    {
+        server_config->work_completion_batch = 1;
+    }
+    else if (server_config->work_completion_batch > 256)
+    {
+        server_config->work_completion_batch = 256;
+    }
+    return 0;
+}
 
-    free(receive_buffer);
-    close(thread_context->socket_file_descriptor);
-    return NULL;
+static void usage_server(const char *program_name)
+{
+    fprintf(stderr,
+            "Usage: %s [--bind ip] [--port p] [--msg-size n] [--max-clients n] [--echo] [--pin-base cpu]\n"
+            "       [--work none|spin|touch|hash|sort] [--work-ns n] [--work-bytes n] [--work-pool n] [--work-inflight n] [--work-batch n]\n"
+            "       [--buffer-pool] [--io-threads n] [--churn] [--duration s] [--accept-batch n] [--reuseport] [--fastopen]\n"
+            "       [--splice] [--udp] [--pubsub subscribers] [--sub-queue n] [--sub-policy block|drop-new|drop-old] [--pubsub-copy]\n"
+            "       [--stripe connections] [--sample-ms n] [--tls]\n",
+            program_name);
 }
 
-static int parse_server_args(int argument_count, char **argument_values, server_config_t *server_config)
+static int parse_transform_list(const char *transform_list_string, client_config_t *client_config)
 {
-    server_config->bind_ip_address[0] = '\0';
-    server_config->port_number = 5001;
-    server_config->message_size = 1024;
-    server_config->maximum_clients = 1;
-    server_config->enable_echo = 0;
-    server_config->cpu_pin_base = -1;
+    char transform_list_copy[128];
+    snprintf(transform_list_copy, sizeof(transform_list_copy), "%s", transform_list_string);
+    client_config->pipeline_stage_count = 0;
 
-    for (int arg_index = 1; arg_index < argument_count; arg_index++)
+    char *save_pointer = NULL;
+    for (char *transform_token = strtok_r(transform_list_copy, ",", &save_pointer); transform_token; transform_token = strtok_r(NULL, ",", &save_pointer))
     {
-        if (strcmp(argument_values[arg_index], "--bind") == 0 && arg_index + 1 < argument_count)
+        enum pipeline_transform transform_kind;
+        if (strcmp(transform_token, "none") == 0)
         {
-            snprintf(server_config->bind_ip_address, sizeof(server_config->bind_ip_address), "%s", argument_values[++arg_index]);
+            continue;
         }
-        else if (strcmp(argument_values[arg_index], "--port") == 0 && arg_index + 1 < argument_count)
+        else if (strcmp(transform_token, "pack") == 0)
         {
-            server_config->port_number = atoi(argument_values[++arg_index]);
+            transform_kind = TRANSFORM_PACK;
         }
-        else if (strcmp(argument_values[arg_index], "--msg-size") == 0 && arg_index + 1 < argument_count)
-        {
-            server_config->message_size = parse_size(argument_values[++arg_index]);
-        }
-        else if (strcmp(argument_values[arg_index], "--max-clients") == 0 && arg_index + 1 < argument_count)
+        else if (strcmp(transform_token, "checksum") == 0)
         {
-            server_config->maximum_clients = atoi(argument_values[++arg_index]);
+            transform_kind = TRANSFORM_CHECKSUM;
         }
-        else if (strcmp(argument_values[arg_index], "--echo") == 0)
+        else if (strcmp(transform_token, "compress") == 0)
         {
-            server_config->enable_echo = 1;
+            transform_kind = TRANSFORM_COMPRESS;
         }
-        else if (strcmp(argument_values[arg_index], "--pin-base") == 0 && arg_index + 1 < argument_count)
+        else
         {
-            server_config->cpu_pin_base = atoi(argument_values[++arg_index]);
+            fprintf(stderr, "unknown transform: %s\n", transform_token);
+            return -1;
         }
-        else if (strcmp(argument_values[arg_index], "--help") == 0)
+        if (client_config->pipeline_stage_count >= PIPELINE_MAX_STAGES)
         {
+            fprintf(stderr, "at most %d transform stages are supported\n", PIPELINE_MAX_STAGES);
             return -1;
         }
+        client_config->pipeline_stages[client_config->pipeline_stage_count++] = transform_kind;
     }
     return 0;
 }
 
-static void usage_server(const char *program_name)
-{
-    fprintf(stderr,
-            "Usage: %s [--bind ip] [--port p] [--msg-size n] [--max-clients n] [--echo] [--pin-base cpu]\n",
-            program_name);
-}
-
 static int parse_client_args(int argument_count, char **argument_values, client_config_t *client_config)
 {
     snprintf(client_config->hostname, sizeof(client_config->hostname), "127.0.0.1");
@@ -397,6 +430,25 @@ static int parse_client_args(int argument_count, char **argument_values, client_
     client_config->enable_echo = 0;
     client_config->cpu_pin_base = -1;
     client_config->zerocopy_inflight_limit = 32;
+    client_config->pipeline_enabled = 0;
+    client_config->pipeline_queue_depth = 64;
+    client_config->pipeline_batch_size = 16;
+    client_config->pipeline_stage_count = 0;
+    client_config->churn_enabled = 0;
+    client_config->churn_session_messages = 1;
+    client_config->fastopen_enabled = 0;
+    client_config->splice_enabled = 0;
+    client_config->send_batch_size = 1;
+    client_config->udp_enabled = 0;
+    client_config->udp_gso_segments = 1;
+    client_config->pubsub_subscriber_count = 0;
+    client_config->pubsub_publish_rate = 0;
+    client_config->pubsub_slow_subscriber_count = 0;
+    client_config->pubsub_slow_delay_microseconds = 0;
+    client_config->stripe_connection_count = 0;
+    client_config->stripe_chunk_size = 1024 * 1024;
+    client_config->sample_interval_milliseconds = 0;
+    client_config->tls_enabled = 0;
 
     for (int arg_index = 1; arg_index < argument_count; arg_index++)
     {
@@ -444,6 +496,85 @@ static int parse_client_args(int argument_count, char **argument_values, client_
         {
             client_config->zerocopy_inflight_limit = atoi(argument_values[++arg_index]);
         }
+        else if (strcmp(argument_values[arg_index], "--pipeline") == 0)
+        {
+            client_config->pipeline_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--transform") == 0 && arg_index + 1 < argument_count)
+        {
+            if (parse_transform_list(argument_values[++arg_index], client_config) != 0)
+            {
+                return -1;
+            }
+        }
+        else if (strcmp(argument_values[arg_index], "--queue-depth") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->pipeline_queue_depth = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--batch") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->pipeline_batch_size = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--churn") == 0)
+        {
+            client_config->churn_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--session-messages") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->churn_session_messages = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--fastopen") == 0)
+        {
+            client_config->fastopen_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--splice") == 0)
+        {
+            client_config->splice_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--send-batch") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->send_batch_size = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--udp") == 0)
+        {
+            client_config->udp_enabled = 1;
+        }
+        else if (strcmp(argument_values[arg_index], "--udp-gso") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->udp_gso_segments = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--pubsub") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->pubsub_subscriber_count = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--pub-rate") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->pubsub_publish_rate = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--slow-subscribers") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->pubsub_slow_subscriber_count = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--slow-delay-us") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->pubsub_slow_delay_microseconds = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--stripe") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->stripe_connection_count = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--chunk-size") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->stripe_chunk_size = parse_size(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--sample-ms") == 0 && arg_index + 1 < argument_count)
+        {
+            client_config->sample_interval_milliseconds = atoi(argument_values[++arg_index]);
+        }
+        else if (strcmp(argument_values[arg_index], "--tls") == 0)
+        {
+            client_config->tls_enabled = 1;
+        }
         else if (strcmp(argument_values[arg_index], "--help") == 0)
         {
             return -1;
@@ -458,257 +589,186 @@ static int parse_client_args(int argument_count, char **argument_values, client_
     {
         client_config->zerocopy_inflight_limit = 1;
     }
-    return 0;
-}
-
-static void usage_client(const char *program_name)
-{
-    fprintf(stderr,
-            "Usage: %s [--host ip] [--port p] [--msg-size n] [--threads n] [--duration s] [--mode throughput|latency] [--echo] [--pin-base cpu] [--zc-inflight n]\n",
-            program_name);
-}
-
-static int zerocopy_enable(int socket_file_descriptor)
-{
-#ifdef SO_ZEROCOPY
-    int enable_option = 1;
-    if (setsockopt(socket_file_descriptor, SOL_SOCKET, SO_ZEROCOPY, &enable_option, sizeof(enable_option)) == 0)
+    if (client_config->send_batch_size < 1)
     {
-        return 1;
+        client_config->send_batch_size = 1;
     }
-#endif
-    return 0;
-}
-
-static int zerocopy_reap(int socket_file_descriptor, int blocking_mode, int *inflight_count_ptr)
-{
-    char control_message_buffer[256];
-    char single_data_byte;
-    struct iovec io_vector;
-    struct msghdr message_header;
-
-    memset(&message_header, 0, sizeof(message_header));
-    io_vector.iov_base = &single_data_byte;
-    io_vector.iov_len = sizeof(single_data_byte);
-    message_header.msg_iov = &io_vector;
-    message_header.msg_iovlen = 1;
-    message_header.msg_control = control_message_buffer;
-    message_header.msg_controllen = sizeof(control_message_buffer);
-
-    int receive_flags = MSG_ERRQUEUE | (blocking_mode ? 0 : MSG_DONTWAIT);
-    ssize_t receive_result = recvmsg(socket_file_descriptor, &message_header, receive_flags);
-    if (receive_result < 0)
+    if (client_config->send_batch_size > TRANSPORT_MAXIMUM_BATCH)
     {
-        if (!blocking_mode && (errno == EAGAIN || errno == EWOULDBLOCK))
-        {
-            return 0;
-        }
+        client_config->send_batch_size = TRANSPORT_MAXIMUM_BATCH;
+    }
+    if (client_config->churn_session_messages < 1)
+    {
+        client_config->churn_session_messages = 1;
+    }
+    if (client_config->churn_enabled && client_config->pipeline_enabled)
+    {
+        fprintf(stderr, "--churn and --pipeline cannot be combined\n");
         return -1;
     }
-
-    for (struct cmsghdr *control_msg_ptr = CMSG_FIRSTHDR(&message_header); control_msg_ptr; control_msg_ptr = CMSG_NXTHDR(&message_header, control_msg_ptr))
+    if (client_config->splice_enabled && client_config->pipeline_enabled)
     {
-        if (control_msg_ptr->cmsg_level == SOL_IP && control_msg_ptr->cmsg_type == IP_RECVERR)
-        {
-            struct sock_extended_err *socket_error_ptr = (struct sock_extended_err *)CMSG_DATA(control_msg_ptr);
-            if (socket_error_ptr && socket_error_ptr->ee_origin == SO_EE_ORIGIN_ZEROCOPY)
-            {
-                uint32_t completion_range_start = socket_error_ptr->ee_info;
-                uint32_t completion_range_end = socket_error_ptr->ee_data;
-                int completed_operations_count = 1;
-                if (completion_range_end >= completion_range_start && completion_range_start != 0)
-                {
-                    completed_operations_count = (int)(completion_range_end - completion_range_start + 1);
-                }
-                *inflight_count_ptr -= completed_operations_count;
-                if (*inflight_count_ptr < 0)
-                {
-                    *inflight_count_ptr = 0;
-                }
-            }
-        }
+        fprintf(stderr, "--splice and --pipeline cannot be combined\n");
+        return -1;
     }
-    return 1;
-}
-
-static void *client_thread_main(void *thread_argument)
-{
-    client_thread_context_t *thread_context = (client_thread_context_t *)thread_argument;
-    if (thread_context->cpu_pin_base >= 0)
+    if (client_config->udp_enabled &&
+        (client_config->enable_echo || client_config->pipeline_enabled || client_config->churn_enabled || client_config->splice_enabled))
     {
-        pin_thread(thread_context->cpu_pin_base + thread_context->thread_index);
+        fprintf(stderr, "--udp measures one-way throughput and cannot be combined with --echo, latency mode, --pipeline, --churn or --splice\n");
+        return -1;
     }
-
-    int zerocopy_inflight_operations = 0;
-    message_t *message_buffers_array = NULL;
-    char *send_packed_buffer = NULL;
-    char *receive_buffer = NULL;
-    struct iovec io_vector_array[FIELD_COUNT];
-
-    if (thread_context->send_operation_mode == SEND_BASELINE)
+    if (client_config->udp_enabled && (client_config->message_size < 16 || client_config->message_size > 65507))
     {
-        message_t current_message;
-        message_init(&current_message, thread_context->message_size);
-        send_packed_buffer = (char *)malloc(thread_context->message_size);
-        if (!send_packed_buffer)
-        {
-            message_free(&current_message);
-            return NULL;
-        }
-        uint64_t operation_start_time_ns = now_ns();
-        while (now_ns() - operation_start_time_ns < (uint64_t)thread_context->duration_seconds * 1000000000ULL)
-        {
-            uint64_t message_send_start_time_ns = 0;
-            if (thread_context->operation_mode == MODE_LATENCY)
-            {
-                message_send_start_time_ns = now_ns();
-            }
-            message_pack(&current_message, send_packed_buffer);
-            if (write_full(thread_context->socket_file_descriptor, send_packed_buffer, thread_context->message_size) <= 0)
-            {
-                break;
-            }
-            thread_context->total_bytes_sent += thread_context->message_size;
-            thread_context->message_count++;
-
-            if (thread_context->enable_echo)
-            {
-                if (read_full(thread_context->socket_file_descriptor, send_packed_buffer, thread_context->message_size) <= 0)
-                {
-                    break;
-                }
-            }
-            if (thread_context->operation_mode == MODE_LATENCY)
-            {
-                uint64_t message_send_end_time_ns = now_ns();
-                thread_context->round_trip_time_nanoseconds_sum += (message_send_end_time_ns - message_send_start_time_ns);
-            }
-        }
-        thread_context->elapsed_nanoseconds = now_ns() - operation_start_time_ns;
-        message_free(&current_message);
-        free(send_packed_buffer);
-        return NULL;
+        fprintf(stderr, "--udp needs a message size between 16 and 65507 bytes\n");
+        return -1;
     }
-
-    int message_buffer_count = (thread_context->send_operation_mode == SEND_ZEROCOPY) ? thread_context->zerocopy_inflight_limit : 1;
-    if (message_buffer_count < 1)
+    if (client_config->pubsub_subscriber_count > 0 &&
+        (client_config->pipeline_enabled || client_config->churn_enabled || client_config->udp_enabled || client_config->splice_enabled))
     {
-        message_buffer_count = 1;
+        fprintf(stderr, "--pubsub cannot be combined with --pipeline, --churn, --udp or --splice\n");
+        return -1;
     }
-    message_buffers_array = (message_t *)calloc((size_t)message_buffer_count, sizeof(message_t));
-    for (int buffer_index = 0; buffer_index < message_buffer_count; buffer_index++)
+    if (client_config->pubsub_subscriber_count > 0 && client_config->message_size < 16)
     {
-        message_init(&message_buffers_array[buffer_index], thread_context->message_size);
+        fprintf(stderr, "--pubsub needs a message size of at least 16 bytes\n");
+        return -1;
     }
-    if (thread_context->enable_echo)
+    if (client_config->stripe_connection_count > 0 &&
+        (client_config->pipeline_enabled || client_config->churn_enabled || client_config->udp_enabled || client_config->splice_enabled ||
+         client_config->pubsub_subscriber_count > 0))
     {
-        receive_buffer = (char *)malloc(thread_context->message_size);
-        if (!receive_buffer)
-        {
-            for (int buffer_index = 0; buffer_index < message_buffer_count; buffer_index++)
-            {
-                message_free(&message_buffers_array[buffer_index]);
-            }
-            free(message_buffers_array);
-            return NULL;
-        }
+        fprintf(stderr, "--stripe cannot be combined with --pipeline, --churn, --udp, --pubsub or --splice\n");
+        return -1;
     }
-
-    if (thread_context->send_operation_mode == SEND_ZEROCOPY)
+    if (client_config->sample_interval_milliseconds > 0 &&
+        (client_config->pipeline_enabled || client_config->churn_enabled || client_config->udp_enabled ||
+         client_config->pubsub_subscriber_count > 0 || client_config->stripe_connection_count > 0))
     {
-        thread_context->zerocopy_enabled = zerocopy_enable(thread_context->socket_file_descriptor);
+        fprintf(stderr, "--sample-ms samples the thread-per-connection client and cannot be combined with --pipeline, --churn, --udp, --pubsub or --stripe\n");
+        return -1;
     }
-
-    uint64_t operation_start_time_ns = now_ns();
-    while (now_ns() - operation_start_time_ns < (uint64_t)thread_context->duration_seconds * 1000000000ULL)
+    if (client_config->tls_enabled &&
+        (client_config->pipeline_enabled || client_config->churn_enabled || client_config->udp_enabled ||
+         client_config->pubsub_subscriber_count > 0 || client_config->stripe_connection_count > 0))
     {
-        int current_buffer_index = (int)(thread_context->message_count % (uint64_t)message_buffer_count);
-        message_iov(&message_buffers_array[current_buffer_index], io_vector_array);
-
-        uint64_t message_send_start_time_ns = 0;
-        if (thread_context->operation_mode == MODE_LATENCY)
-        {
-            message_send_start_time_ns = now_ns();
-        }
-
-        int send_flags = MSG_NOSIGNAL;
-        if (thread_context->send_operation_mode == SEND_ZEROCOPY && thread_context->zerocopy_enabled)
-        {
-#ifdef MSG_ZEROCOPY
-            send_flags |= MSG_ZEROCOPY;
-#endif
-        }
-
-        struct iovec io_vector_working_copy[FIELD_COUNT];
-        memcpy(io_vector_working_copy, io_vector_array, sizeof(io_vector_working_copy));
-        int send_result = sendmsg_full(thread_context->socket_file_descriptor, io_vector_working_copy, FIELD_COUNT, send_flags);
-        if (send_result < 0)
+        fprintf(stderr, "--tls runs on the thread-per-connection client and cannot be combined with --pipeline, --churn, --udp, --pubsub or --stripe\n");
+        return -1;
+    }
+    if (client_config->stripe_connection_count > STRIPE_MAXIMUM_CONNECTIONS)
+    {
+        client_config->stripe_connection_count = STRIPE_MAXIMUM_CONNECTIONS;
+    }
+    if (client_config->stripe_chunk_size < 1)
+    {
+        client_config->stripe_chunk_size = 1;
+    }
+    if (client_config->pubsub_slow_delay_microseconds > 999999)
+    {
+        client_config->pubsub_slow_delay_microseconds = 999999;
+    }
+    if (client_config->pipeline_queue_depth < 2)
+    {
+        client_config->pipeline_queue_depth = 2;
+    }
+    if (client_config->pipeline_batch_size < 1)
+    {
+        client_config->pipeline_batch_size = 1;
+    }
+    else if (client_config->pipeline_batch_size > 1024)
+    {
+        client_config->pipeline_batch_size = 1024;
+    }
+    for (int stage_index = 0; stage_index < client_config->pipeline_stage_count; stage_index++)
+    {
+        if (client_config->pipeline_enabled && client_config->pipeline_stages[stage_index] == TRANSFORM_COMPRESS && client_config->enable_echo)
         {
-            if (thread_context->send_operation_mode == SEND_ZEROCOPY && thread_context->zerocopy_enabled &&
-                (errno == EINVAL || errno == EOPNOTSUPP))
-            {
-                thread_context->zerocopy_enabled = 0;
-                continue;
-            }
-            break;
+            fprintf(stderr, "--transform compress changes the wire size and cannot be combined with --echo or latency mode\n");
+            return -1;
         }
-        thread_context->total_bytes_sent += thread_context->message_size;
-        thread_context->message_count++;
+    }
+    return 0;
+}
 
-        if (thread_context->send_operation_mode == SEND_ZEROCOPY && thread_context->zerocopy_enabled)
-        {
-            zerocopy_inflight_operations++;
-            if (zerocopy_inflight_operations >= thread_context->zerocopy_inflight_limit)
-            {
-                while (zerocopy_inflight_operations >= thread_context->zerocopy_inflight_limit)
-                {
-                    if (zerocopy_reap(thread_context->socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
-                    {
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                zerocopy_reap(thread_context->socket_file_descriptor, 0, &zerocopy_inflight_operations);
-            }
-        }
+static void usage_client(const char *program_name)
+{
+    fprintf(stderr,
+            "Usage: %s [--host ip] [--port p] [--msg-size n] [--threads n] [--duration s] [--mode throughput|latency] [--echo] [--pin-base cpu] [--zc-inflight n]\n"
+            "       [--pipeline] [--transform pack,checksum,compress] [--queue-depth n] [--batch n]\n"
+            "       [--churn] [--session-messages n] [--fastopen] [--splice] [--send-batch n]\n"
+            "       [--udp] [--udp-gso n] [--pubsub subscribers] [--pub-rate msgs/s] [--slow-subscribers n] [--slow-delay-us n]\n"
+            "       [--stripe connections] [--chunk-size n] [--sample-ms n] [--tls]\n",
+            program_name);
+}
 
-        if (thread_context->enable_echo)
-        {
-            if (read_full(thread_context->socket_file_descriptor, receive_buffer, thread_context->message_size) <= 0)
-            {
-                break;
-            }
-        }
+static void *client_thread_main(void *thread_argument)
+{
+    client_thread_context_t *thread_context = (client_thread_context_t *)thread_argument;
+    if (thread_context->cpu_pin_base >= 0)
+    {
+        pin_thread(thread_context->cpu_pin_base + thread_context->thread_index);
+    }
+    thread_context->send_loop(&thread_context->transport_sender);
+    return NULL;
+}
 
-        if (thread_context->operation_mode == MODE_LATENCY)
+long read_process_memory_kilobytes(const char *field_name)
+{
+    FILE *status_file = fopen("/proc/self/status", "r");
+    if (!status_file)
+    {
+        return -1;
+    }
+    char status_line[256];
+    long field_value_kilobytes = -1;
+    size_t field_name_length = strlen(field_name);
+    while (fgets(status_line, sizeof(status_line), status_file))
+    {
+        if (strncmp(status_line, field_name, field_name_length) == 0)
         {
-            uint64_t message_send_end_time_ns = now_ns();
-            thread_context->round_trip_time_nanoseconds_sum += (message_send_end_time_ns - message_send_start_time_ns);
+            field_value_kilobytes = strtol(status_line + field_name_length, NULL, 10);
+            break;
         }
     }
+    fclose(status_file);
+    return field_value_kilobytes;
+}
 
-    if (thread_context->send_operation_mode == SEND_ZEROCOPY && thread_context->zerocopy_enabled)
+void report_server_memory(const char *server_model_name, int connection_count, long baseline_resident_kilobytes)
+{
+    long peak_resident_kilobytes = read_process_memory_kilobytes("VmHWM:");
+    double bytes_per_connection = 0.0;
+    if (connection_count > 0 && peak_resident_kilobytes > baseline_resident_kilobytes && baseline_resident_kilobytes >= 0)
     {
-        while (zerocopy_inflight_operations > 0)
-        {
-            if (zerocopy_reap(thread_context->socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
-            {
-                break;
-            }
-        }
+        bytes_per_connection = (double)(peak_resident_kilobytes - baseline_resident_kilobytes) * 1024.0 / (double)connection_count;
     }
+    printf("SERVER_MEMORY,%s,%d,%ld,%ld,%.0f\n",
+           server_model_name,
+           connection_count,
+           peak_resident_kilobytes,
+           baseline_resident_kilobytes,
+           bytes_per_connection);
+}
 
-    thread_context->elapsed_nanoseconds = now_ns() - operation_start_time_ns;
+void report_result(enum run_mode operation_mode, uint64_t total_bytes, uint64_t total_messages, uint64_t round_trip_time_nanoseconds_sum, uint64_t elapsed_nanoseconds)
+{
+    double elapsed_time_seconds = (elapsed_nanoseconds > 0) ? (double)elapsed_nanoseconds / 1e9 : 0.0;
+    double calculated_throughput_gbps = 0.0;
+    double calculated_latency_microseconds = 0.0;
 
-    for (int buffer_index = 0; buffer_index < message_buffer_count; buffer_index++)
+    if (elapsed_time_seconds > 0.0)
     {
-        message_free(&message_buffers_array[buffer_index]);
+        calculated_throughput_gbps = ((double)total_bytes * 8.0) / (elapsed_time_seconds * 1e9);
     }
-    free(message_buffers_array);
-    free(receive_buffer);
-    return NULL;
+    if (operation_mode == MODE_LATENCY && total_messages > 0)
+    {
+        calculated_latency_microseconds = ((double)round_trip_time_nanoseconds_sum / (double)total_messages) / 1000.0;
+    }
+
+    printf("RESULT,%.6f,%.3f,%llu,%.6f\n",
+           calculated_throughput_gbps,
+           calculated_latency_microseconds,
+           (unsigned long long)total_bytes,
+           elapsed_time_seconds);
 }
 
 int run_server(int argument_count, char **argument_values)
@@ -720,13 +780,36 @@ int run_server(int argument_count, char **argument_values)
         return 1;
     }
 
-    int listen_socket_fd = create_server_socket(server_configuration.bind_ip_address, server_configuration.port_number);
+    if (server_configuration.churn_enabled)
+    {
+        return run_churn_server(&server_configuration);
+    }
+    if (server_configuration.udp_enabled)
+    {
+        return run_udp_server(&server_configuration);
+    }
+
+    int listen_socket_fd = create_server_socket(server_configuration.bind_ip_address, server_configuration.port_number, 0);
     if (listen_socket_fd < 0)
     {
         perror("listen");
         return 1;
     }
 
+    if (server_configuration.buffer_pool_enabled)
+    {
+        return run_buffer_pool_server(&server_configuration, listen_socket_fd);
+    }
+    if (server_configuration.pubsub_subscriber_count > 0)
+    {
+        return run_pubsub_server(&server_configuration, listen_socket_fd);
+    }
+    if (server_configuration.stripe_connection_count > 0)
+    {
+        return run_stripe_server(&server_configuration, listen_socket_fd);
+    }
+
+    long baseline_resident_kilobytes = read_process_memory_kilobytes("VmRSS:");
     pthread_t *server_thread_array = (pthread_t *)calloc((size_t)server_configuration.maximum_clients, sizeof(pthread_t));
     server_thread_context_t *thread_context_array = (server_thread_context_t *)calloc((size_t)server_configuration.maximum_clients, sizeof(server_thread_context_t));
     if (!server_thread_array || !thread_context_array)
@@ -735,6 +818,21 @@ int run_server(int argument_count, char **argument_values)
         return 1;
     }
 
+    server_work_pool_t *work_pool_ptr = NULL;
+    if (server_configuration.work_pool_threads > 0)
+    {
+        work_pool_ptr = server_work_pool_create(&server_configuration);
+        if (!work_pool_ptr)
+        {
+            fprintf(stderr, "work pool allocation failed\n");
+            free(server_thread_array);
+            free(thread_context_array);
+            close(listen_socket_fd);
+            return 1;
+        }
+    }
+
+    kernel_sampler_t *kernel_sampler_ptr = NULL;
     int accepted_connections_count = 0;
     while (accepted_connections_count < server_configuration.maximum_clients)
     {
@@ -752,17 +850,44 @@ int run_server(int argument_count, char **argument_values)
         thread_context_array[accepted_connections_count].enable_echo = server_configuration.enable_echo;
         thread_context_array[accepted_connections_count].thread_index = accepted_connections_count;
         thread_context_array[accepted_connections_count].cpu_pin_base = server_configuration.cpu_pin_base;
+        thread_context_array[accepted_connections_count].server_config = &server_configuration;
+        thread_context_array[accepted_connections_count].work_pool_ptr = work_pool_ptr;
+        if (server_configuration.sample_interval_milliseconds > 0 && !kernel_sampler_ptr)
+        {
+            kernel_sampler_ptr = kernel_sampler_start("SERVER_SAMPLE", server_configuration.sample_interval_milliseconds, server_configuration.maximum_clients);
+        }
+        thread_context_array[accepted_connections_count].kernel_sampler_ptr = kernel_sampler_ptr;
+        kernel_sampler_add_socket(kernel_sampler_ptr, accepted_socket_fd, &thread_context_array[accepted_connections_count].transport_receiver.total_bytes_received);
         pthread_create(&server_thread_array[accepted_connections_count], NULL, server_thread_main, &thread_context_array[accepted_connections_count]);
         accepted_connections_count++;
     }
 
     close(listen_socket_fd);
 
+    latency_histogram_t *aggregated_service_histogram = (latency_histogram_t *)calloc(1, sizeof(latency_histogram_t));
     for (int thread_index = 0; thread_index < accepted_connections_count; thread_index++)
     {
         pthread_join(server_thread_array[thread_index], NULL);
+        if (aggregated_service_histogram)
+        {
+            latency_histogram_merge(aggregated_service_histogram, &thread_context_array[thread_index].service_histogram);
+        }
+    }
+    kernel_sampler_stop(kernel_sampler_ptr);
+
+    report_server_memory("thread", accepted_connections_count, baseline_resident_kilobytes);
+    server_work_pool_destroy(work_pool_ptr);
+    if (server_configuration.work_kind != WORK_NONE && aggregated_service_histogram)
+    {
+        char service_line_prefix[96];
+        snprintf(service_line_prefix, sizeof(service_line_prefix), "SERVER_WORK,%s,%s,%llu",
+                 server_work_kind_name(server_configuration.work_kind),
+                 server_configuration.work_pool_threads > 0 ? "pool" : "inline",
+                 (unsigned long long)aggregated_service_histogram->total_count);
+        report_latency_percentiles(service_line_prefix, aggregated_service_histogram);
     }
 
+    free(aggregated_service_histogram);
     free(server_thread_array);
     free(thread_context_array);
     return 0;
@@ -777,6 +902,81 @@ int run_client(int argument_count, char **argument_values, enum send_mode send_o
         return 1;
     }
 
+    if (client_configuration.churn_enabled)
+    {
+        return run_churn_client(&client_configuration, send_operation_mode);
+    }
+    if (client_configuration.udp_enabled)
+    {
+        return run_udp_client(&client_configuration, send_operation_mode);
+    }
+    if (client_configuration.pubsub_subscriber_count > 0)
+    {
+        return run_pubsub_client(&client_configuration);
+    }
+    if (client_configuration.stripe_connection_count > 0)
+    {
+        return run_stripe_client(&client_configuration, send_operation_mode);
+    }
+
+    if (client_configuration.pipeline_enabled)
+    {
+        int *connection_socket_array = (int *)calloc((size_t)client_configuration.thread_count, sizeof(int));
+        if (!connection_socket_array)
+        {
+            return 1;
+        }
+        for (int thread_index = 0; thread_index < client_configuration.thread_count; thread_index++)
+        {
+            connection_socket_array[thread_index] = create_client_socket(client_configuration.hostname, client_configuration.port_number);
+            if (connection_socket_array[thread_index] < 0)
+            {
+                fprintf(stderr, "connect failed\n");
+                return 1;
+            }
+        }
+        int pipeline_status = run_pipeline_client(&client_configuration, connection_socket_array, send_operation_mode);
+        for (int thread_index = 0; thread_index < client_configuration.thread_count; thread_index++)
+        {
+            close(connection_socket_array[thread_index]);
+        }
+        free(connection_socket_array);
+        return pipeline_status;
+    }
+
+    enum transport_send_policy send_policy = TRANSPORT_SEND_COPY;
+    if (client_configuration.splice_enabled)
+    {
+        send_policy = TRANSPORT_SEND_SPLICE;
+    }
+    else if (send_operation_mode == SEND_SENDMSG)
+    {
+        send_policy = TRANSPORT_SEND_SENDMSG;
+    }
+    else if (send_operation_mode == SEND_ZEROCOPY)
+    {
+        send_policy = client_configuration.tls_enabled ? TRANSPORT_SEND_SPLICE : TRANSPORT_SEND_ZEROCOPY;
+    }
+    int policy_flags = 0;
+    if (client_configuration.enable_echo)
+    {
+        policy_flags |= TRANSPORT_POLICY_ECHO;
+    }
+    if (client_configuration.send_batch_size > 1)
+    {
+        policy_flags |= TRANSPORT_POLICY_BATCHING;
+    }
+    if (client_configuration.operation_mode == MODE_LATENCY)
+    {
+        policy_flags |= TRANSPORT_POLICY_LATENCY_TIMING;
+    }
+    transport_send_loop_t send_loop = transport_select_send_loop(send_policy, policy_flags);
+    if (!send_loop)
+    {
+        fprintf(stderr, "no %s send loop for policy flags 0x%x\n", transport_send_policy_name(send_policy), policy_flags);
+        return 1;
+    }
+
     pthread_t *client_thread_array = (pthread_t *)calloc((size_t)client_configuration.thread_count, sizeof(pthread_t));
     client_thread_context_t *thread_context_array = (client_thread_context_t *)calloc((size_t)client_configuration.thread_count, sizeof(client_thread_context_t));
     if (!client_thread_array || !thread_context_array)
@@ -784,6 +984,12 @@ int run_client(int argument_count, char **argument_values, enum send_mode send_o
         return 1;
     }
 
+    kernel_sampler_t *kernel_sampler_ptr = NULL;
+    if (client_configuration.sample_interval_milliseconds > 0)
+    {
+        kernel_sampler_ptr = kernel_sampler_start("SAMPLE", client_configuration.sample_interval_milliseconds, client_configuration.thread_count);
+    }
+
     for (int thread_index = 0; thread_index < client_configuration.thread_count; thread_index++)
     {
         int connection_socket_fd = create_client_socket(client_configuration.hostname, client_configuration.port_number);
@@ -792,15 +998,21 @@ int run_client(int argument_count, char **argument_values, enum send_mode send_o
             fprintf(stderr, "connect failed\n");
             return 1;
         }
-        thread_context_array[thread_index].thread_index = thread_index;
-        thread_context_array[thread_index].socket_file_descriptor = connection_socket_fd;
-        thread_context_array[thread_index].message_size = client_configuration.message_size;
-        thread_context_array[thread_index].duration_seconds = client_configuration.duration_seconds;
-        thread_context_array[thread_index].operation_mode = client_configuration.operation_mode;
-        thread_context_array[thread_index].enable_echo = client_configuration.enable_echo;
-        thread_context_array[thread_index].send_operation_mode = send_operation_mode;
-        thread_context_array[thread_index].cpu_pin_base = client_configuration.cpu_pin_base;
-        thread_context_array[thread_index].zerocopy_inflight_limit = client_configuration.zerocopy_inflight_limit;
+        if (client_configuration.tls_enabled && ktls_enable(connection_socket_fd, KTLS_ROLE_CLIENT) != 0)
+        {
+            report_ktls_failure();
+            return 1;
+        }
+        client_thread_context_t *thread_context = &thread_context_array[thread_index];
+        thread_context->thread_index = thread_index;
+        thread_context->cpu_pin_base = client_configuration.cpu_pin_base;
+        thread_context->send_loop = send_loop;
+        thread_context->transport_sender.socket_file_descriptor = connection_socket_fd;
+        thread_context->transport_sender.message_size = client_configuration.message_size;
+        thread_context->transport_sender.batch_size = client_configuration.send_batch_size;
+        thread_context->transport_sender.zerocopy_inflight_limit = client_configuration.zerocopy_inflight_limit;
+        thread_context->transport_sender.duration_nanoseconds = (uint64_t)client_configuration.duration_seconds * 1000000000ULL;
+        kernel_sampler_add_socket(kernel_sampler_ptr, connection_socket_fd, &thread_context->transport_sender.total_bytes_sent);
         pthread_create(&client_thread_array[thread_index], NULL, client_thread_main, &thread_context_array[thread_index]);
     }
 
@@ -808,39 +1020,42 @@ int run_client(int argument_count, char **argument_values, enum send_mode send_o
     uint64_t aggregated_total_messages = 0;
     uint64_t aggregated_round_trip_time_ns = 0;
     uint64_t maximum_elapsed_nanoseconds = 0;
+    latency_histogram_t *aggregated_round_trip_histogram = (latency_histogram_t *)calloc(1, sizeof(latency_histogram_t));
 
     for (int thread_index = 0; thread_index < client_configuration.thread_count; thread_index++)
     {
         pthread_join(client_thread_array[thread_index], NULL);
-        close(thread_context_array[thread_index].socket_file_descriptor);
-        aggregated_total_bytes += thread_context_array[thread_index].total_bytes_sent;
-        aggregated_total_messages += thread_context_array[thread_index].message_count;
-        aggregated_round_trip_time_ns += thread_context_array[thread_index].round_trip_time_nanoseconds_sum;
-        if (thread_context_array[thread_index].elapsed_nanoseconds > maximum_elapsed_nanoseconds)
+    }
+    kernel_sampler_stop(kernel_sampler_ptr);
+
+    for (int thread_index = 0; thread_index < client_configuration.thread_count; thread_index++)
+    {
+        transport_sender_t *transport_sender_ptr = &thread_context_array[thread_index].transport_sender;
+        close(transport_sender_ptr->socket_file_descriptor);
+        if (aggregated_round_trip_histogram)
         {
-            maximum_elapsed_nanoseconds = thread_context_array[thread_index].elapsed_nanoseconds;
+            latency_histogram_merge(aggregated_round_trip_histogram, &transport_sender_ptr->round_trip_histogram);
+        }
+        aggregated_total_bytes += transport_sender_ptr->total_bytes_sent;
+        aggregated_total_messages += transport_sender_ptr->message_count;
+        aggregated_round_trip_time_ns += transport_sender_ptr->round_trip_time_nanoseconds_sum;
+        if (transport_sender_ptr->elapsed_nanoseconds > maximum_elapsed_nanoseconds)
+        {
+            maximum_elapsed_nanoseconds = transport_sender_ptr->elapsed_nanoseconds;
         }
     }
 
-    double elapsed_time_seconds = (maximum_elapsed_nanoseconds > 0) ? (double)maximum_elapsed_nanoseconds / 1e9 : 0.0;
-    double calculated_throughput_gbps = 0.0;
-    double calculated_latency_microseconds = 0.0;
-
-    if (elapsed_time_seconds > 0.0)
+    report_result(client_configuration.operation_mode, aggregated_total_bytes, aggregated_total_messages, aggregated_round_trip_time_ns, maximum_elapsed_nanoseconds);
+    if (client_configuration.tls_enabled)
     {
-        calculated_throughput_gbps = ((double)aggregated_total_bytes * 8.0) / (elapsed_time_seconds * 1e9);
+        printf("TLS,aes-gcm-128,%s\n", transport_send_policy_name(send_policy));
     }
-    if (client_configuration.operation_mode == MODE_LATENCY && aggregated_total_messages > 0)
+    if (client_configuration.operation_mode == MODE_LATENCY && aggregated_round_trip_histogram)
     {
-        calculated_latency_microseconds = ((double)aggregated_round_trip_time_ns / (double)aggregated_total_messages) / 1000.0;
+        report_latency_percentiles("LATENCY_PERCENTILES", aggregated_round_trip_histogram);
     }
 
-    printf("RESULT,%.6f,%.3f,%llu,%.6f\n",
-           calculated_throughput_gbps,
-           calculated_latency_microseconds,
-           (unsigned long long)aggregated_total_bytes,
-           elapsed_time_seconds);
-
+    free(aggregated_round_trip_histogram);
     free(client_thread_array);
     free(thread_context_array);
     return 0;
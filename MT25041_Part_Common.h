@@ -1,25 +1,10 @@
 #ifndef MT25041_PART_COMMON_H
 #define MT25041_PART_COMMON_H
 
-#include <arpa/inet.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <linux/errqueue.h>
-#include <netdb.h>
-#include <netinet/in.h>
-#include <netinet/tcp.h>
-#include <pthread.h>
-#include <sched.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/socket.h>
-#include <sys/types.h>
-#include <time.h>
-#include <unistd.h>
-
-#define FIELD_COUNT 8
+#include "MT25041_Part_Transport.h"
+
+#define PIPELINE_MAX_STAGES 3
+#define STRIPE_MAXIMUM_CONNECTIONS 64
 
 enum run_mode
 {
@@ -34,12 +19,137 @@ enum send_mode
     SEND_ZEROCOPY = 2
 };
 
+enum pipeline_transform
+{
+    TRANSFORM_PACK = 0,
+    TRANSFORM_CHECKSUM = 1,
+    TRANSFORM_COMPRESS = 2
+};
+
+enum server_work_kind
+{
+    WORK_NONE = 0,
+    WORK_SPIN = 1,
+    WORK_TOUCH = 2,
+    WORK_HASH = 3,
+    WORK_SORT = 4
+};
+
+enum pubsub_drop_policy
+{
+    PUBSUB_BLOCK = 0,
+    PUBSUB_DROP_NEWEST = 1,
+    PUBSUB_DROP_OLDEST = 2
+};
+
 typedef struct
 {
-    char *field_buffers[FIELD_COUNT];
-    size_t field_sizes[FIELD_COUNT];
-    size_t total_message_size;
-} message_t;
+    char bind_ip_address[64];
+    int port_number;
+    size_t message_size;
+    int maximum_clients;
+    int enable_echo;
+    int cpu_pin_base;
+    enum server_work_kind work_kind;
+    uint64_t work_nanoseconds;
+    size_t work_working_set_bytes;
+    int work_pool_threads;
+    int work_inflight_limit;
+    int work_completion_batch;
+    int buffer_pool_enabled;
+    int io_thread_count;
+    int churn_enabled;
+    int duration_seconds;
+    int accept_batch_size;
+    int reuseport_enabled;
+    int fastopen_enabled;
+    enum transport_receive_policy receive_policy;
+    int udp_enabled;
+    int pubsub_subscriber_count;
+    int pubsub_queue_depth;
+    enum pubsub_drop_policy pubsub_drop_policy;
+    int pubsub_zerocopy_enabled;
+    int stripe_connection_count;
+    int sample_interval_milliseconds;
+    int tls_enabled;
+} server_config_t;
+
+typedef struct
+{
+    char *working_set_buffer;
+    size_t working_set_bytes;
+    uint32_t *sort_buffer;
+    size_t sort_capacity;
+    uint64_t result_sink;
+} server_work_scratch_t;
+
+typedef struct server_work_pool server_work_pool_t;
+typedef struct kernel_sampler kernel_sampler_t;
+
+typedef struct
+{
+    char hostname[64];
+    int port_number;
+    size_t message_size;
+    int thread_count;
+    int duration_seconds;
+    enum run_mode operation_mode;
+    int enable_echo;
+    int cpu_pin_base;
+    int zerocopy_inflight_limit;
+    int pipeline_enabled;
+    int pipeline_queue_depth;
+    int pipeline_batch_size;
+    int pipeline_stage_count;
+    enum pipeline_transform pipeline_stages[PIPELINE_MAX_STAGES];
+    int churn_enabled;
+    int churn_session_messages;
+    int fastopen_enabled;
+    int splice_enabled;
+    int send_batch_size;
+    int udp_enabled;
+    int udp_gso_segments;
+    int pubsub_subscriber_count;
+    int pubsub_publish_rate;
+    int pubsub_slow_subscriber_count;
+    int pubsub_slow_delay_microseconds;
+    int stripe_connection_count;
+    size_t stripe_chunk_size;
+    int sample_interval_milliseconds;
+    int tls_enabled;
+} client_config_t;
+
+size_t parse_size(const char *size_string);
+
+const char *server_work_kind_name(enum server_work_kind work_kind);
+int server_work_parse_kind(const char *kind_string, enum server_work_kind *work_kind_ptr);
+int server_work_scratch_init(server_work_scratch_t *scratch_ptr, const server_config_t *server_config);
+void server_work_scratch_free(server_work_scratch_t *scratch_ptr);
+void server_work_execute(const server_config_t *server_config, server_work_scratch_t *scratch_ptr, const char *payload_buffer, size_t payload_length);
+server_work_pool_t *server_work_pool_create(const server_config_t *server_config);
+void server_work_pool_destroy(server_work_pool_t *work_pool_ptr);
+int server_work_serve_connection(server_work_pool_t *work_pool_ptr, const server_config_t *server_config, int socket_file_descriptor, latency_histogram_t *service_histogram_ptr, uint64_t *received_bytes_ptr);
+
+int run_buffer_pool_server(const server_config_t *server_config, int listen_socket_fd);
+int run_churn_server(const server_config_t *server_config);
+int run_churn_client(const client_config_t *client_config, enum send_mode send_operation_mode);
+int run_udp_server(const server_config_t *server_config);
+int run_udp_client(const client_config_t *client_config, enum send_mode send_operation_mode);
+const char *pubsub_drop_policy_name(enum pubsub_drop_policy drop_policy);
+int pubsub_parse_drop_policy(const char *policy_string, enum pubsub_drop_policy *drop_policy_ptr);
+int run_pubsub_server(const server_config_t *server_config, int listen_socket_fd);
+int run_pubsub_client(const client_config_t *client_config);
+int run_stripe_server(const server_config_t *server_config, int listen_socket_fd);
+int run_stripe_client(const client_config_t *client_config, enum send_mode send_operation_mode);
+kernel_sampler_t *kernel_sampler_start(const char *line_prefix, int interval_milliseconds, int maximum_socket_count);
+void kernel_sampler_add_socket(kernel_sampler_t *sampler_ptr, int socket_file_descriptor, const uint64_t *byte_counter_ptr);
+void kernel_sampler_remove_socket(kernel_sampler_t *sampler_ptr, int socket_file_descriptor);
+void kernel_sampler_stop(kernel_sampler_t *sampler_ptr);
+long read_process_memory_kilobytes(const char *field_name);
+void report_server_memory(const char *server_model_name, int connection_count, long baseline_resident_kilobytes);
+
+void report_result(enum run_mode operation_mode, uint64_t total_bytes, uint64_t total_messages, uint64_t round_trip_time_nanoseconds_sum, uint64_t elapsed_nanoseconds);
+int run_pipeline_client(const client_config_t *client_config, const int *socket_file_descriptors, enum send_mode send_operation_mode);
 
 int run_server(int argument_count, char **argument_values);
 int run_client(int argument_count, char **argument_values, enum send_mode mode);
@@ -0,0 +1,647 @@
+#include "MT25041_Part_Common.h"
+#include "MT25041_Part_Ring.h"
+
+#define PIPELINE_STAGE_SLOTS (PIPELINE_MAX_STAGES + 2)
+
+typedef struct
+{
+    message_t message_fields;
+    char *packed_buffer;
+    char *compressed_buffer;
+    const char *payload_pointer;
+    size_t payload_length;
+    int payload_packed;
+    uint32_t payload_checksum;
+    uint64_t sequence_number;
+    uint64_t produced_time_ns;
+    uint64_t zerocopy_last_call_index;
+} pipeline_slot_t;
+
+typedef struct pipeline_lane pipeline_lane_t;
+
+typedef struct
+{
+    pipeline_lane_t *lane_ptr;
+    int stage_index;
+    enum pipeline_transform transform_kind;
+    spsc_ring_t *input_ring;
+    spsc_ring_t *output_ring;
+    uint64_t processed_messages;
+    uint64_t busy_nanoseconds;
+    uint64_t elapsed_nanoseconds;
+} pipeline_stage_context_t;
+
+struct pipeline_lane
+{
+    int lane_index;
+    int socket_file_descriptor;
+    const client_config_t *client_config;
+    enum send_mode send_operation_mode;
+    atomic_int *abort_flag_ptr;
+    uint64_t start_time_ns;
+    int slot_count;
+    pipeline_slot_t *slot_array;
+    spsc_ring_t free_ring;
+    spsc_ring_t stage_rings[PIPELINE_MAX_STAGES + 1];
+    pipeline_stage_context_t stage_contexts[PIPELINE_STAGE_SLOTS];
+    pthread_t stage_threads[PIPELINE_STAGE_SLOTS];
+    int zerocopy_enabled;
+    uint64_t total_bytes_sent;
+    uint64_t message_count;
+    uint64_t round_trip_time_nanoseconds_sum;
+    uint64_t elapsed_nanoseconds;
+    latency_histogram_t round_trip_histogram;
+};
+
+static const char *pipeline_transform_name(enum pipeline_transform transform_kind)
+{
+    switch (transform_kind)
+    {
+    case TRANSFORM_PACK:
+        return "pack";
+    case TRANSFORM_CHECKSUM:
+        return "checksum";
+    case TRANSFORM_COMPRESS:
+        return "compress";
+    }
+    return "unknown";
+}
+
+static const char *pipeline_stage_name(const pipeline_lane_t *lane_ptr, int stage_index)
+{
+    int transform_stage_count = lane_ptr->client_config->pipeline_stage_count;
+    if (stage_index == 0)
+    {
+        return "producer";
+    }
+    if (stage_index > transform_stage_count)
+    {
+        return "sender";
+    }
+    return pipeline_transform_name(lane_ptr->client_config->pipeline_stages[stage_index - 1]);
+}
+
+static void pipeline_ring_push_blocking(spsc_ring_t *ring_ptr, void *item_ptr)
+{
+    while (!spsc_ring_push(ring_ptr, item_ptr))
+    {
+        sched_yield();
+    }
+}
+
+static uint32_t pipeline_checksum_bytes(uint32_t running_checksum, const char *data_pointer, size_t data_length)
+{
+    for (size_t byte_index = 0; byte_index < data_length; byte_index++)
+    {
+        running_checksum ^= (uint8_t)data_pointer[byte_index];
+        running_checksum *= 16777619u;
+    }
+    return running_checksum;
+}
+
+static size_t pipeline_compress_rle(const char *source_pointer, size_t source_length, char *destination_pointer)
+{
+    size_t source_offset = 0;
+    size_t destination_offset = 0;
+    while (source_offset < source_length)
+    {
+        char run_value = source_pointer[source_offset];
+        size_t run_length = 1;
+        while (source_offset + run_length < source_length && run_length < 255 && source_pointer[source_offset + run_length] == run_value)
+        {
+            run_length++;
+        }
+        destination_pointer[destination_offset++] = (char)run_length;
+        destination_pointer[destination_offset++] = run_value;
+        source_offset += run_length;
+    }
+    return destination_offset;
+}
+
+static void pipeline_apply_transform(enum pipeline_transform transform_kind, pipeline_slot_t *slot_ptr)
+{
+    if (transform_kind == TRANSFORM_PACK)
+    {
+        message_pack(&slot_ptr->message_fields, slot_ptr->packed_buffer);
+        slot_ptr->payload_pointer = slot_ptr->packed_buffer;
+        slot_ptr->payload_length = slot_ptr->message_fields.total_message_size;
+        slot_ptr->payload_packed = 1;
+    }
+    else if (transform_kind == TRANSFORM_CHECKSUM)
+    {
+        uint32_t running_checksum = 2166136261u;
+        if (slot_ptr->payload_packed)
+        {
+            running_checksum = pipeline_checksum_bytes(running_checksum, slot_ptr->payload_pointer, slot_ptr->payload_length);
+        }
+        else
+        {
+            for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+            {
+                running_checksum = pipeline_checksum_bytes(running_checksum, slot_ptr->message_fields.field_buffers[field_index], slot_ptr->message_fields.field_sizes[field_index]);
+            }
+        }
+        slot_ptr->payload_checksum = running_checksum;
+    }
+    else if (transform_kind == TRANSFORM_COMPRESS)
+    {
+        size_t compressed_length = 0;
+        if (slot_ptr->payload_packed)
+        {
+            compressed_length = pipeline_compress_rle(slot_ptr->payload_pointer, slot_ptr->payload_length, slot_ptr->compressed_buffer);
+        }
+        else
+        {
+            for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+            {
+                compressed_length += pipeline_compress_rle(slot_ptr->message_fields.field_buffers[field_index], slot_ptr->message_fields.field_sizes[field_index], slot_ptr->compressed_buffer + compressed_length);
+            }
+        }
+        slot_ptr->payload_pointer = slot_ptr->compressed_buffer;
+        slot_ptr->payload_length = compressed_length;
+        slot_ptr->payload_packed = 1;
+    }
+}
+
+static void *pipeline_producer_main(void *thread_argument)
+{
+    pipeline_stage_context_t *stage_context = (pipeline_stage_context_t *)thread_argument;
+    pipeline_lane_t *lane_ptr = stage_context->lane_ptr;
+    const client_config_t *client_config = lane_ptr->client_config;
+    size_t batch_size = (size_t)client_config->pipeline_batch_size;
+    void *slot_batch[batch_size];
+    uint64_t duration_nanoseconds = (uint64_t)client_config->duration_seconds * 1000000000ULL;
+    uint64_t next_sequence_number = 0;
+
+    while (!atomic_load_explicit(lane_ptr->abort_flag_ptr, memory_order_relaxed) && now_ns() - lane_ptr->start_time_ns < duration_nanoseconds)
+    {
+        size_t popped_slot_count = spsc_ring_pop_batch(&lane_ptr->free_ring, slot_batch, batch_size);
+        if (popped_slot_count == 0)
+        {
+            sched_yield();
+            continue;
+        }
+        uint64_t batch_start_time_ns = now_ns();
+        for (size_t slot_index = 0; slot_index < popped_slot_count; slot_index++)
+        {
+            pipeline_slot_t *slot_ptr = (pipeline_slot_t *)slot_batch[slot_index];
+            slot_ptr->sequence_number = next_sequence_number++;
+            slot_ptr->produced_time_ns = batch_start_time_ns;
+            size_t stamp_length = slot_ptr->message_fields.field_sizes[0] < sizeof(slot_ptr->sequence_number) ? slot_ptr->message_fields.field_sizes[0] : sizeof(slot_ptr->sequence_number);
+            memcpy(slot_ptr->message_fields.field_buffers[0], &slot_ptr->sequence_number, stamp_length);
+            slot_ptr->payload_pointer = NULL;
+            slot_ptr->payload_length = slot_ptr->message_fields.total_message_size;
+            slot_ptr->payload_packed = 0;
+            slot_ptr->payload_checksum = 0;
+            pipeline_ring_push_blocking(stage_context->output_ring, slot_ptr);
+        }
+        stage_context->processed_messages += popped_slot_count;
+        stage_context->busy_nanoseconds += now_ns() - batch_start_time_ns;
+    }
+
+    spsc_ring_close(stage_context->output_ring);
+    stage_context->elapsed_nanoseconds = now_ns() - lane_ptr->start_time_ns;
+    return NULL;
+}
+
+static void *pipeline_transform_main(void *thread_argument)
+{
+    pipeline_stage_context_t *stage_context = (pipeline_stage_context_t *)thread_argument;
+    pipeline_lane_t *lane_ptr = stage_context->lane_ptr;
+    size_t batch_size = (size_t)lane_ptr->client_config->pipeline_batch_size;
+    void *slot_batch[batch_size];
+
+    while (1)
+    {
+        size_t popped_slot_count = spsc_ring_pop_batch(stage_context->input_ring, slot_batch, batch_size);
+        if (popped_slot_count == 0)
+        {
+            if (spsc_ring_is_drained(stage_context->input_ring))
+            {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+        uint64_t batch_start_time_ns = now_ns();
+        for (size_t slot_index = 0; slot_index < popped_slot_count; slot_index++)
+        {
+            pipeline_apply_transform(stage_context->transform_kind, (pipeline_slot_t *)slot_batch[slot_index]);
+            pipeline_ring_push_blocking(stage_context->output_ring, slot_batch[slot_index]);
+        }
+        stage_context->processed_messages += popped_slot_count;
+        stage_context->busy_nanoseconds += now_ns() - batch_start_time_ns;
+    }
+
+    spsc_ring_close(stage_context->output_ring);
+    stage_context->elapsed_nanoseconds = now_ns() - lane_ptr->start_time_ns;
+    return NULL;
+}
+
+static void pipeline_release_completed(pipeline_lane_t *lane_ptr, pipeline_slot_t **pending_slot_array, int *pending_head_ptr, int *pending_count_ptr, uint64_t completed_call_count)
+{
+    while (*pending_count_ptr > 0 && pending_slot_array[*pending_head_ptr]->zerocopy_last_call_index <= completed_call_count)
+    {
+        pipeline_ring_push_blocking(&lane_ptr->free_ring, pending_slot_array[*pending_head_ptr]);
+        *pending_head_ptr = (*pending_head_ptr + 1) % lane_ptr->slot_count;
+        (*pending_count_ptr)--;
+    }
+}
+
+static int pipeline_send_slot(pipeline_lane_t *lane_ptr, pipeline_slot_t *slot_ptr, int *zerocopy_call_count_ptr)
+{
+    if (!slot_ptr->payload_packed && lane_ptr->send_operation_mode == SEND_BASELINE)
+    {
+        pipeline_apply_transform(TRANSFORM_PACK, slot_ptr);
+    }
+    if (lane_ptr->send_operation_mode == SEND_BASELINE)
+    {
+        return write_full(lane_ptr->socket_file_descriptor, slot_ptr->payload_pointer, slot_ptr->payload_length);
+    }
+
+    int send_flags = MSG_NOSIGNAL;
+    int zerocopy_requested = 0;
+    if (lane_ptr->send_operation_mode == SEND_ZEROCOPY && lane_ptr->zerocopy_enabled)
+    {
+#ifdef MSG_ZEROCOPY
+        send_flags |= MSG_ZEROCOPY;
+        zerocopy_requested = 1;
+#endif
+    }
+    struct iovec io_vector_array[FIELD_COUNT];
+    int iovec_count = 1;
+    if (slot_ptr->payload_packed)
+    {
+        io_vector_array[0].iov_base = (void *)slot_ptr->payload_pointer;
+        io_vector_array[0].iov_len = slot_ptr->payload_length;
+    }
+    else
+    {
+        message_iov(&slot_ptr->message_fields, io_vector_array);
+        iovec_count = FIELD_COUNT;
+    }
+    if (!zerocopy_requested)
+    {
+        return sendmsg_full(lane_ptr->socket_file_descriptor, io_vector_array, iovec_count, send_flags);
+    }
+    int send_result = sendmsg_full_counted(lane_ptr->socket_file_descriptor, io_vector_array, iovec_count, send_flags, zerocopy_call_count_ptr);
+    if (send_result < 0 && (errno == EINVAL || errno == EOPNOTSUPP))
+    {
+        lane_ptr->zerocopy_enabled = 0;
+        send_result = sendmsg_full(lane_ptr->socket_file_descriptor, io_vector_array, iovec_count, MSG_NOSIGNAL);
+    }
+    return send_result;
+}
+
+static void *pipeline_sender_main(void *thread_argument)
+{
+    pipeline_stage_context_t *stage_context = (pipeline_stage_context_t *)thread_argument;
+    pipeline_lane_t *lane_ptr = stage_context->lane_ptr;
+    const client_config_t *client_config = lane_ptr->client_config;
+    size_t batch_size = (size_t)client_config->pipeline_batch_size;
+    void *slot_batch[batch_size];
+    pipeline_slot_t **pending_slot_array = (pipeline_slot_t **)calloc((size_t)lane_ptr->slot_count, sizeof(pipeline_slot_t *));
+    char *receive_buffer = client_config->enable_echo ? (char *)malloc(client_config->message_size) : NULL;
+    int pending_head_index = 0;
+    int pending_slot_count = 0;
+    int zerocopy_inflight_operations = 0;
+    uint64_t zerocopy_issued_calls = 0;
+    int sender_failed = (!pending_slot_array || (client_config->enable_echo && !receive_buffer));
+
+    if (lane_ptr->send_operation_mode == SEND_ZEROCOPY)
+    {
+        lane_ptr->zerocopy_enabled = zerocopy_enable(lane_ptr->socket_file_descriptor);
+    }
+
+    while (!sender_failed)
+    {
+        size_t popped_slot_count = spsc_ring_pop_batch(stage_context->input_ring, slot_batch, batch_size);
+        if (popped_slot_count == 0)
+        {
+            if (zerocopy_inflight_operations > 0)
+            {
+                if (zerocopy_reap(lane_ptr->socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
+                {
+                    zerocopy_inflight_operations = 0;
+                }
+                pipeline_release_completed(lane_ptr, pending_slot_array, &pending_head_index, &pending_slot_count,
+                                           zerocopy_issued_calls - (uint64_t)zerocopy_inflight_operations);
+                continue;
+            }
+            if (spsc_ring_is_drained(stage_context->input_ring))
+            {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+
+        uint64_t batch_start_time_ns = now_ns();
+        for (size_t slot_index = 0; slot_index < popped_slot_count; slot_index++)
+        {
+            pipeline_slot_t *slot_ptr = (pipeline_slot_t *)slot_batch[slot_index];
+            if (sender_failed)
+            {
+                pipeline_ring_push_blocking(&lane_ptr->free_ring, slot_ptr);
+                continue;
+            }
+            int zerocopy_call_count = 0;
+            int send_result = pipeline_send_slot(lane_ptr, slot_ptr, &zerocopy_call_count);
+            if (zerocopy_call_count > 0)
+            {
+                zerocopy_issued_calls += (uint64_t)zerocopy_call_count;
+                zerocopy_inflight_operations += zerocopy_call_count;
+                slot_ptr->zerocopy_last_call_index = zerocopy_issued_calls;
+                pending_slot_array[(pending_head_index + pending_slot_count) % lane_ptr->slot_count] = slot_ptr;
+                pending_slot_count++;
+            }
+            if (send_result <= 0)
+            {
+                sender_failed = 1;
+                atomic_store_explicit(lane_ptr->abort_flag_ptr, 1, memory_order_relaxed);
+                if (zerocopy_call_count == 0)
+                {
+                    pipeline_ring_push_blocking(&lane_ptr->free_ring, slot_ptr);
+                }
+                continue;
+            }
+            lane_ptr->total_bytes_sent += slot_ptr->payload_length;
+            lane_ptr->message_count++;
+
+            if (zerocopy_call_count > 0)
+            {
+                while (zerocopy_inflight_operations >= client_config->zerocopy_inflight_limit)
+                {
+                    if (zerocopy_reap(lane_ptr->socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
+                    {
+                        break;
+                    }
+                }
+                zerocopy_reap(lane_ptr->socket_file_descriptor, 0, &zerocopy_inflight_operations);
+            }
+
+            if (client_config->enable_echo)
+            {
+                if (read_full(lane_ptr->socket_file_descriptor, receive_buffer, client_config->message_size) <= 0)
+                {
+                    sender_failed = 1;
+                    atomic_store_explicit(lane_ptr->abort_flag_ptr, 1, memory_order_relaxed);
+                }
+            }
+            if (client_config->operation_mode == MODE_LATENCY && !sender_failed)
+            {
+                uint64_t round_trip_nanoseconds = now_ns() - slot_ptr->produced_time_ns;
+                lane_ptr->round_trip_time_nanoseconds_sum += round_trip_nanoseconds;
+                latency_histogram_record(&lane_ptr->round_trip_histogram, round_trip_nanoseconds);
+            }
+
+            if (zerocopy_call_count == 0)
+            {
+                pipeline_ring_push_blocking(&lane_ptr->free_ring, slot_ptr);
+            }
+            pipeline_release_completed(lane_ptr, pending_slot_array, &pending_head_index, &pending_slot_count,
+                                       zerocopy_issued_calls - (uint64_t)zerocopy_inflight_operations);
+        }
+        stage_context->processed_messages += popped_slot_count;
+        stage_context->busy_nanoseconds += now_ns() - batch_start_time_ns;
+    }
+
+    while (zerocopy_inflight_operations > 0)
+    {
+        if (zerocopy_reap(lane_ptr->socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
+        {
+            break;
+        }
+    }
+    while (!spsc_ring_is_drained(stage_context->input_ring))
+    {
+        if (spsc_ring_pop_batch(stage_context->input_ring, slot_batch, batch_size) == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    stage_context->elapsed_nanoseconds = now_ns() - lane_ptr->start_time_ns;
+    lane_ptr->elapsed_nanoseconds = stage_context->elapsed_nanoseconds;
+    free(pending_slot_array);
+    free(receive_buffer);
+    return NULL;
+}
+
+static void *pipeline_stage_entry(void *thread_argument)
+{
+    pipeline_stage_context_t *stage_context = (pipeline_stage_context_t *)thread_argument;
+    pipeline_lane_t *lane_ptr = stage_context->lane_ptr;
+    const client_config_t *client_config = lane_ptr->client_config;
+    if (client_config->cpu_pin_base >= 0)
+    {
+        pin_thread(client_config->cpu_pin_base + lane_ptr->lane_index * (client_config->pipeline_stage_count + 2) + stage_context->stage_index);
+    }
+    if (stage_context->stage_index == 0)
+    {
+        return pipeline_producer_main(thread_argument);
+    }
+    if (stage_context->stage_index > client_config->pipeline_stage_count)
+    {
+        return pipeline_sender_main(thread_argument);
+    }
+    return pipeline_transform_main(thread_argument);
+}
+
+static int pipeline_lane_init(pipeline_lane_t *lane_ptr)
+{
+    const client_config_t *client_config = lane_ptr->client_config;
+    size_t ring_capacity = spsc_ring_round_capacity((size_t)client_config->pipeline_queue_depth);
+    lane_ptr->slot_count = (int)ring_capacity;
+    lane_ptr->slot_array = (pipeline_slot_t *)calloc(ring_capacity, sizeof(pipeline_slot_t));
+    if (!lane_ptr->slot_array || spsc_ring_init(&lane_ptr->free_ring, ring_capacity) != 0)
+    {
+        return -1;
+    }
+    for (int ring_index = 0; ring_index <= client_config->pipeline_stage_count; ring_index++)
+    {
+        if (spsc_ring_init(&lane_ptr->stage_rings[ring_index], ring_capacity) != 0)
+        {
+            return -1;
+        }
+    }
+    for (int slot_index = 0; slot_index < lane_ptr->slot_count; slot_index++)
+    {
+        pipeline_slot_t *slot_ptr = &lane_ptr->slot_array[slot_index];
+        message_init(&slot_ptr->message_fields, client_config->message_size);
+        slot_ptr->packed_buffer = (char *)malloc(client_config->message_size);
+        slot_ptr->compressed_buffer = (char *)malloc(client_config->message_size * 2 + FIELD_COUNT * 2);
+        if (!slot_ptr->packed_buffer || !slot_ptr->compressed_buffer)
+        {
+            return -1;
+        }
+        spsc_ring_push(&lane_ptr->free_ring, slot_ptr);
+    }
+    return 0;
+}
+
+static void pipeline_lane_free(pipeline_lane_t *lane_ptr)
+{
+    if (lane_ptr->slot_array)
+    {
+        for (int slot_index = 0; slot_index < lane_ptr->slot_count; slot_index++)
+        {
+            message_free(&lane_ptr->slot_array[slot_index].message_fields);
+            free(lane_ptr->slot_array[slot_index].packed_buffer);
+            free(lane_ptr->slot_array[slot_index].compressed_buffer);
+        }
+    }
+    free(lane_ptr->slot_array);
+    spsc_ring_destroy(&lane_ptr->free_ring);
+    for (int ring_index = 0; ring_index <= PIPELINE_MAX_STAGES; ring_index++)
+    {
+        spsc_ring_destroy(&lane_ptr->stage_rings[ring_index]);
+    }
+}
+
+static void pipeline_report_stages(pipeline_lane_t *lane_array, const client_config_t *client_config)
+{
+    int stage_slot_count = client_config->pipeline_stage_count + 2;
+    double occupancy_sum_array[PIPELINE_STAGE_SLOTS] = {0};
+
+    for (int lane_index = 0; lane_index < client_config->thread_count; lane_index++)
+    {
+        pipeline_lane_t *lane_ptr = &lane_array[lane_index];
+        for (int stage_index = 0; stage_index < stage_slot_count; stage_index++)
+        {
+            pipeline_stage_context_t *stage_context = &lane_ptr->stage_contexts[stage_index];
+            double stage_occupancy = 0.0;
+            if (stage_context->elapsed_nanoseconds > 0)
+            {
+                stage_occupancy = (double)stage_context->busy_nanoseconds / (double)stage_context->elapsed_nanoseconds;
+            }
+            occupancy_sum_array[stage_index] += stage_occupancy;
+            printf("PIPELINE_STAGE,%d,%s,%llu,%.4f\n",
+                   lane_index,
+                   pipeline_stage_name(lane_ptr, stage_index),
+                   (unsigned long long)stage_context->processed_messages,
+                   stage_occupancy);
+        }
+        for (int ring_index = 0; ring_index <= client_config->pipeline_stage_count; ring_index++)
+        {
+            spsc_ring_t *ring_ptr = &lane_ptr->stage_rings[ring_index];
+            double average_depth = ring_ptr->depth_sample_count ? (double)ring_ptr->depth_sample_sum / (double)ring_ptr->depth_sample_count : 0.0;
+            printf("PIPELINE_QUEUE,%d,%s->%s,%.2f,%zu,%zu\n",
+                   lane_index,
+                   pipeline_stage_name(lane_ptr, ring_index),
+                   pipeline_stage_name(lane_ptr, ring_index + 1),
+                   average_depth,
+                   ring_ptr->maximum_observed_depth,
+                   ring_ptr->capacity_mask + 1);
+        }
+    }
+
+    int bottleneck_stage_index = 0;
+    for (int stage_index = 1; stage_index < stage_slot_count; stage_index++)
+    {
+        if (occupancy_sum_array[stage_index] > occupancy_sum_array[bottleneck_stage_index])
+        {
+            bottleneck_stage_index = stage_index;
+        }
+    }
+    printf("PIPELINE_BOTTLENECK,%s,%.4f\n",
+           pipeline_stage_name(&lane_array[0], bottleneck_stage_index),
+           occupancy_sum_array[bottleneck_stage_index] / (double)client_config->thread_count);
+}
+
+int run_pipeline_client(const client_config_t *client_config, const int *socket_file_descriptors, enum send_mode send_operation_mode)
+{
+    pipeline_lane_t *lane_array = (pipeline_lane_t *)calloc((size_t)client_config->thread_count, sizeof(pipeline_lane_t));
+    if (!lane_array)
+    {
+        return 1;
+    }
+    atomic_int abort_flag;
+    atomic_init(&abort_flag, 0);
+    int stage_slot_count = client_config->pipeline_stage_count + 2;
+    int initialized_lane_count = 0;
+
+    for (int lane_index = 0; lane_index < client_config->thread_count; lane_index++)
+    {
+        pipeline_lane_t *lane_ptr = &lane_array[lane_index];
+        lane_ptr->lane_index = lane_index;
+        lane_ptr->socket_file_descriptor = socket_file_descriptors[lane_index];
+        lane_ptr->client_config = client_config;
+        lane_ptr->send_operation_mode = send_operation_mode;
+        lane_ptr->abort_flag_ptr = &abort_flag;
+        initialized_lane_count++;
+        if (pipeline_lane_init(lane_ptr) != 0)
+        {
+            fprintf(stderr, "pipeline allocation failed\n");
+            for (int free_index = 0; free_index < initialized_lane_count; free_index++)
+            {
+                pipeline_lane_free(&lane_array[free_index]);
+            }
+            free(lane_array);
+            return 1;
+        }
+        for (int stage_index = 0; stage_index < stage_slot_count; stage_index++)
+        {
+            pipeline_stage_context_t *stage_context = &lane_ptr->stage_contexts[stage_index];
+            stage_context->lane_ptr = lane_ptr;
+            stage_context->stage_index = stage_index;
+            stage_context->input_ring = (stage_index > 0) ? &lane_ptr->stage_rings[stage_index - 1] : NULL;
+            stage_context->output_ring = (stage_index < stage_slot_count - 1) ? &lane_ptr->stage_rings[stage_index] : NULL;
+            if (stage_index > 0 && stage_index <= client_config->pipeline_stage_count)
+            {
+                stage_context->transform_kind = client_config->pipeline_stages[stage_index - 1];
+            }
+        }
+    }
+
+    for (int lane_index = 0; lane_index < client_config->thread_count; lane_index++)
+    {
+        pipeline_lane_t *lane_ptr = &lane_array[lane_index];
+        lane_ptr->start_time_ns = now_ns();
+        for (int stage_index = stage_slot_count - 1; stage_index >= 0; stage_index--)
+        {
+            pthread_create(&lane_ptr->stage_threads[stage_index], NULL, pipeline_stage_entry, &lane_ptr->stage_contexts[stage_index]);
+        }
+    }
+
+    uint64_t aggregated_total_bytes = 0;
+    uint64_t aggregated_total_messages = 0;
+    uint64_t aggregated_round_trip_time_ns = 0;
+    uint64_t maximum_elapsed_nanoseconds = 0;
+    latency_histogram_t *aggregated_round_trip_histogram = (latency_histogram_t *)calloc(1, sizeof(latency_histogram_t));
+
+    for (int lane_index = 0; lane_index < client_config->thread_count; lane_index++)
+    {
+        pipeline_lane_t *lane_ptr = &lane_array[lane_index];
+        for (int stage_index = 0; stage_index < stage_slot_count; stage_index++)
+        {
+            pthread_join(lane_ptr->stage_threads[stage_index], NULL);
+        }
+        aggregated_total_bytes += lane_ptr->total_bytes_sent;
+        aggregated_total_messages += lane_ptr->message_count;
+        aggregated_round_trip_time_ns += lane_ptr->round_trip_time_nanoseconds_sum;
+        if (aggregated_round_trip_histogram)
+        {
+            latency_histogram_merge(aggregated_round_trip_histogram, &lane_ptr->round_trip_histogram);
+        }
+        if (lane_ptr->elapsed_nanoseconds > maximum_elapsed_nanoseconds)
+        {
+            maximum_elapsed_nanoseconds = lane_ptr->elapsed_nanoseconds;
+        }
+    }
+
+    report_result(client_config->operation_mode, aggregated_total_bytes, aggregated_total_messages, aggregated_round_trip_time_ns, maximum_elapsed_nanoseconds);
+    if (client_config->operation_mode == MODE_LATENCY && aggregated_round_trip_histogram)
+    {
+        report_latency_percentiles("LATENCY_PERCENTILES", aggregated_round_trip_histogram);
+    }
+    pipeline_report_stages(lane_array, client_config);
+    free(aggregated_round_trip_histogram);
+
+    for (int lane_index = 0; lane_index < client_config->thread_count; lane_index++)
+    {
+        pipeline_lane_free(&lane_array[lane_index]);
+    }
+    free(lane_array);
+    return 0;
+}
@@ -0,0 +1,773 @@
+#include "MT25041_Part_Common.h"
+
+#include <sys/epoll.h>
+
+#define PUBSUB_HEADER_BYTES 16
+#define PUBSUB_ROLE_PUBLISHER 'P'
+#define PUBSUB_ROLE_SUBSCRIBER 'S'
+#define PUBSUB_MAX_EVENTS 64
+#define PUBSUB_READS_PER_WAKEUP 64
+#define PUBSUB_WAIT_MILLISECONDS 100
+#define PUBSUB_DRAIN_TIMEOUT_NANOSECONDS 2000000000ULL
+#define PUBSUB_RELEASE_SLACK 256
+
+typedef struct pubsub_buffer
+{
+    struct pubsub_buffer *next_free_buffer;
+    int reference_count;
+    char payload[];
+} pubsub_buffer_t;
+
+typedef struct
+{
+    pubsub_buffer_t *free_buffer_list;
+    size_t message_size;
+    uint64_t allocated_buffer_count;
+    uint64_t outstanding_buffer_count;
+    uint64_t peak_outstanding_buffer_count;
+} pubsub_buffer_pool_t;
+
+typedef struct
+{
+    pubsub_buffer_t *buffer_ptr;
+    uint32_t last_zerocopy_id;
+} pubsub_pending_release_t;
+
+typedef struct
+{
+    int socket_file_descriptor;
+    int connected;
+    int write_interest;
+    pubsub_buffer_t **send_queue;
+    int queue_head;
+    int queue_count;
+    size_t head_offset;
+    pubsub_pending_release_t *release_queue;
+    int release_head;
+    int release_count;
+    int release_capacity;
+    int zerocopy_enabled;
+    int zerocopy_inflight_count;
+    uint32_t zerocopy_next_id;
+    uint64_t sent_message_count;
+    uint64_t dropped_message_count;
+    int peak_queue_count;
+} pubsub_subscriber_t;
+
+typedef struct
+{
+    const client_config_t *client_config;
+    int subscriber_index;
+    int socket_file_descriptor;
+    uint64_t delivered_message_count;
+    uint64_t missing_message_count;
+    uint64_t delivery_latency_sum_ns;
+    latency_histogram_t delivery_histogram;
+} pubsub_subscriber_context_t;
+
+typedef struct
+{
+    const client_config_t *client_config;
+    int socket_file_descriptor;
+    uint64_t published_message_count;
+    uint64_t elapsed_nanoseconds;
+} pubsub_publisher_context_t;
+
+const char *pubsub_drop_policy_name(enum pubsub_drop_policy drop_policy)
+{
+    switch (drop_policy)
+    {
+    case PUBSUB_DROP_NEWEST:
+        return "drop-new";
+    case PUBSUB_DROP_OLDEST:
+        return "drop-old";
+    default:
+        return "block";
+    }
+}
+
+int pubsub_parse_drop_policy(const char *policy_string, enum pubsub_drop_policy *drop_policy_ptr)
+{
+    if (strcmp(policy_string, "block") == 0)
+    {
+        *drop_policy_ptr = PUBSUB_BLOCK;
+    }
+    else if (strcmp(policy_string, "drop-new") == 0)
+    {
+        *drop_policy_ptr = PUBSUB_DROP_NEWEST;
+    }
+    else if (strcmp(policy_string, "drop-old") == 0)
+    {
+        *drop_policy_ptr = PUBSUB_DROP_OLDEST;
+    }
+    else
+    {
+        return -1;
+    }
+    return 0;
+}
+
+static pubsub_buffer_t *pubsub_buffer_acquire(pubsub_buffer_pool_t *buffer_pool_ptr)
+{
+    pubsub_buffer_t *buffer_ptr = buffer_pool_ptr->free_buffer_list;
+    if (buffer_ptr)
+    {
+        buffer_pool_ptr->free_buffer_list = buffer_ptr->next_free_buffer;
+    }
+    else
+    {
+        buffer_ptr = (pubsub_buffer_t *)malloc(sizeof(pubsub_buffer_t) + buffer_pool_ptr->message_size);
+        if (!buffer_ptr)
+        {
+            return NULL;
+        }
+        buffer_pool_ptr->allocated_buffer_count++;
+    }
+    buffer_ptr->reference_count = 1;
+    buffer_pool_ptr->outstanding_buffer_count++;
+    if (buffer_pool_ptr->outstanding_buffer_count > buffer_pool_ptr->peak_outstanding_buffer_count)
+    {
+        buffer_pool_ptr->peak_outstanding_buffer_count = buffer_pool_ptr->outstanding_buffer_count;
+    }
+    return buffer_ptr;
+}
+
+static void pubsub_buffer_release(pubsub_buffer_pool_t *buffer_pool_ptr, pubsub_buffer_t *buffer_ptr)
+{
+    if (--buffer_ptr->reference_count > 0)
+    {
+        return;
+    }
+    buffer_ptr->next_free_buffer = buffer_pool_ptr->free_buffer_list;
+    buffer_pool_ptr->free_buffer_list = buffer_ptr;
+    buffer_pool_ptr->outstanding_buffer_count--;
+}
+
+static void pubsub_buffer_pool_destroy(pubsub_buffer_pool_t *buffer_pool_ptr)
+{
+    while (buffer_pool_ptr->free_buffer_list)
+    {
+        pubsub_buffer_t *buffer_ptr = buffer_pool_ptr->free_buffer_list;
+        buffer_pool_ptr->free_buffer_list = buffer_ptr->next_free_buffer;
+        free(buffer_ptr);
+    }
+}
+
+static void pubsub_update_write_interest(int epoll_file_descriptor, pubsub_subscriber_t *subscriber_ptr, int subscriber_index, int write_interest)
+{
+    if (subscriber_ptr->write_interest == write_interest)
+    {
+        return;
+    }
+    struct epoll_event subscriber_event;
+    memset(&subscriber_event, 0, sizeof(subscriber_event));
+    subscriber_event.events = write_interest ? EPOLLOUT : 0;
+    subscriber_event.data.u32 = (uint32_t)subscriber_index + 1;
+    epoll_ctl(epoll_file_descriptor, EPOLL_CTL_MOD, subscriber_ptr->socket_file_descriptor, &subscriber_event);
+    subscriber_ptr->write_interest = write_interest;
+}
+
+static void pubsub_reap_completions(pubsub_buffer_pool_t *buffer_pool_ptr, pubsub_subscriber_t *subscriber_ptr)
+{
+    while (subscriber_ptr->zerocopy_inflight_count > 0 && zerocopy_reap(subscriber_ptr->socket_file_descriptor, 0, &subscriber_ptr->zerocopy_inflight_count) > 0)
+    {
+    }
+    uint32_t completed_id_limit = subscriber_ptr->zerocopy_next_id - (uint32_t)subscriber_ptr->zerocopy_inflight_count;
+    while (subscriber_ptr->release_count > 0)
+    {
+        pubsub_pending_release_t *release_ptr = &subscriber_ptr->release_queue[subscriber_ptr->release_head];
+        if ((int32_t)(completed_id_limit - release_ptr->last_zerocopy_id) <= 0)
+        {
+            break;
+        }
+        pubsub_buffer_release(buffer_pool_ptr, release_ptr->buffer_ptr);
+        subscriber_ptr->release_head = (subscriber_ptr->release_head + 1) % subscriber_ptr->release_capacity;
+        subscriber_ptr->release_count--;
+    }
+}
+
+static void pubsub_disconnect_subscriber(pubsub_buffer_pool_t *buffer_pool_ptr, int epoll_file_descriptor, pubsub_subscriber_t *subscriber_ptr, int queue_capacity)
+{
+    if (!subscriber_ptr->connected)
+    {
+        return;
+    }
+    epoll_ctl(epoll_file_descriptor, EPOLL_CTL_DEL, subscriber_ptr->socket_file_descriptor, NULL);
+    close(subscriber_ptr->socket_file_descriptor);
+    subscriber_ptr->connected = 0;
+    while (subscriber_ptr->queue_count > 0)
+    {
+        pubsub_buffer_release(buffer_pool_ptr, subscriber_ptr->send_queue[subscriber_ptr->queue_head]);
+        subscriber_ptr->queue_head = (subscriber_ptr->queue_head + 1) % queue_capacity;
+        subscriber_ptr->queue_count--;
+    }
+    while (subscriber_ptr->release_count > 0)
+    {
+        pubsub_buffer_release(buffer_pool_ptr, subscriber_ptr->release_queue[subscriber_ptr->release_head].buffer_ptr);
+        subscriber_ptr->release_head = (subscriber_ptr->release_head + 1) % subscriber_ptr->release_capacity;
+        subscriber_ptr->release_count--;
+    }
+}
+
+static void pubsub_flush_subscriber(pubsub_buffer_pool_t *buffer_pool_ptr, int epoll_file_descriptor, pubsub_subscriber_t *subscriber_ptr, int subscriber_index, int queue_capacity)
+{
+    size_t message_size = buffer_pool_ptr->message_size;
+    int send_flags = MSG_DONTWAIT | MSG_NOSIGNAL;
+#ifdef MSG_ZEROCOPY
+    if (subscriber_ptr->zerocopy_enabled)
+    {
+        send_flags |= MSG_ZEROCOPY;
+    }
+#endif
+    while (subscriber_ptr->connected && subscriber_ptr->queue_count > 0)
+    {
+        if (subscriber_ptr->zerocopy_enabled && subscriber_ptr->release_count >= subscriber_ptr->release_capacity)
+        {
+            pubsub_reap_completions(buffer_pool_ptr, subscriber_ptr);
+            if (subscriber_ptr->release_count >= subscriber_ptr->release_capacity)
+            {
+                break;
+            }
+        }
+        pubsub_buffer_t *buffer_ptr = subscriber_ptr->send_queue[subscriber_ptr->queue_head];
+        ssize_t send_result = send(subscriber_ptr->socket_file_descriptor, buffer_ptr->payload + subscriber_ptr->head_offset,
+                                   message_size - subscriber_ptr->head_offset, send_flags);
+        if (send_result < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS)
+            {
+                pubsub_update_write_interest(epoll_file_descriptor, subscriber_ptr, subscriber_index, 1);
+                return;
+            }
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            pubsub_disconnect_subscriber(buffer_pool_ptr, epoll_file_descriptor, subscriber_ptr, queue_capacity);
+            return;
+        }
+        uint32_t zerocopy_id = subscriber_ptr->zerocopy_next_id;
+        if (subscriber_ptr->zerocopy_enabled)
+        {
+            subscriber_ptr->zerocopy_next_id++;
+            subscriber_ptr->zerocopy_inflight_count++;
+        }
+        subscriber_ptr->head_offset += (size_t)send_result;
+        if (subscriber_ptr->head_offset < message_size)
+        {
+            continue;
+        }
+        subscriber_ptr->head_offset = 0;
+        subscriber_ptr->queue_head = (subscriber_ptr->queue_head + 1) % queue_capacity;
+        subscriber_ptr->queue_count--;
+        subscriber_ptr->sent_message_count++;
+        if (subscriber_ptr->zerocopy_enabled)
+        {
+            int release_tail = (subscriber_ptr->release_head + subscriber_ptr->release_count) % subscriber_ptr->release_capacity;
+            subscriber_ptr->release_queue[release_tail].buffer_ptr = buffer_ptr;
+            subscriber_ptr->release_queue[release_tail].last_zerocopy_id = zerocopy_id;
+            subscriber_ptr->release_count++;
+        }
+        else
+        {
+            pubsub_buffer_release(buffer_pool_ptr, buffer_ptr);
+        }
+    }
+    pubsub_update_write_interest(epoll_file_descriptor, subscriber_ptr, subscriber_index, subscriber_ptr->connected && subscriber_ptr->queue_count > 0);
+}
+
+static int pubsub_enqueue(pubsub_buffer_pool_t *buffer_pool_ptr, pubsub_subscriber_t *subscriber_ptr, pubsub_buffer_t *buffer_ptr,
+                          enum pubsub_drop_policy drop_policy, int queue_capacity)
+{
+    if (!subscriber_ptr->connected)
+    {
+        return 0;
+    }
+    if (subscriber_ptr->queue_count >= queue_capacity)
+    {
+        if (drop_policy != PUBSUB_DROP_OLDEST)
+        {
+            subscriber_ptr->dropped_message_count++;
+            return 0;
+        }
+        int drop_position = subscriber_ptr->head_offset > 0 ? 1 : 0;
+        int drop_index = (subscriber_ptr->queue_head + drop_position) % queue_capacity;
+        pubsub_buffer_release(buffer_pool_ptr, subscriber_ptr->send_queue[drop_index]);
+        for (int shift_position = drop_position; shift_position > 0; shift_position--)
+        {
+            int destination_index = (subscriber_ptr->queue_head + shift_position) % queue_capacity;
+            int source_index = (subscriber_ptr->queue_head + shift_position - 1) % queue_capacity;
+            subscriber_ptr->send_queue[destination_index] = subscriber_ptr->send_queue[source_index];
+        }
+        subscriber_ptr->queue_head = (subscriber_ptr->queue_head + 1) % queue_capacity;
+        subscriber_ptr->queue_count--;
+        subscriber_ptr->dropped_message_count++;
+    }
+    int queue_tail = (subscriber_ptr->queue_head + subscriber_ptr->queue_count) % queue_capacity;
+    subscriber_ptr->send_queue[queue_tail] = buffer_ptr;
+    subscriber_ptr->queue_count++;
+    buffer_ptr->reference_count++;
+    if (subscriber_ptr->queue_count > subscriber_ptr->peak_queue_count)
+    {
+        subscriber_ptr->peak_queue_count = subscriber_ptr->queue_count;
+    }
+    return 1;
+}
+
+static int pubsub_accept_role(int listen_socket_fd, char *role_ptr)
+{
+    int connection_socket_fd = accept(listen_socket_fd, NULL, NULL);
+    if (connection_socket_fd < 0)
+    {
+        return -1;
+    }
+    if (read_full(connection_socket_fd, role_ptr, 1) <= 0)
+    {
+        close(connection_socket_fd);
+        return -1;
+    }
+    return connection_socket_fd;
+}
+
+int run_pubsub_server(const server_config_t *server_config, int listen_socket_fd)
+{
+    int subscriber_count = server_config->pubsub_subscriber_count;
+    int queue_capacity = server_config->pubsub_queue_depth;
+    pubsub_subscriber_t *subscriber_array = (pubsub_subscriber_t *)calloc((size_t)subscriber_count, sizeof(pubsub_subscriber_t));
+    if (!subscriber_array)
+    {
+        return 1;
+    }
+    pubsub_buffer_pool_t buffer_pool;
+    memset(&buffer_pool, 0, sizeof(buffer_pool));
+    buffer_pool.message_size = server_config->message_size;
+
+    int publisher_socket_fd = -1;
+    int connected_subscriber_count = 0;
+    while (publisher_socket_fd < 0 || connected_subscriber_count < subscriber_count)
+    {
+        char connection_role = 0;
+        int connection_socket_fd = pubsub_accept_role(listen_socket_fd, &connection_role);
+        if (connection_socket_fd < 0)
+        {
+            continue;
+        }
+        if (connection_role == PUBSUB_ROLE_PUBLISHER && publisher_socket_fd < 0)
+        {
+            publisher_socket_fd = connection_socket_fd;
+        }
+        else if (connection_role == PUBSUB_ROLE_SUBSCRIBER && connected_subscriber_count < subscriber_count)
+        {
+            pubsub_subscriber_t *subscriber_ptr = &subscriber_array[connected_subscriber_count++];
+            subscriber_ptr->socket_file_descriptor = connection_socket_fd;
+            subscriber_ptr->connected = 1;
+            subscriber_ptr->send_queue = (pubsub_buffer_t **)calloc((size_t)queue_capacity, sizeof(pubsub_buffer_t *));
+            subscriber_ptr->release_capacity = queue_capacity + PUBSUB_RELEASE_SLACK;
+            subscriber_ptr->release_queue = (pubsub_pending_release_t *)calloc((size_t)subscriber_ptr->release_capacity, sizeof(pubsub_pending_release_t));
+            subscriber_ptr->zerocopy_enabled = server_config->pubsub_zerocopy_enabled ? zerocopy_enable(connection_socket_fd) : 0;
+            if (!subscriber_ptr->send_queue || !subscriber_ptr->release_queue)
+            {
+                return 1;
+            }
+        }
+        else
+        {
+            close(connection_socket_fd);
+        }
+    }
+    close(listen_socket_fd);
+    if (server_config->cpu_pin_base >= 0)
+    {
+        pin_thread(server_config->cpu_pin_base);
+    }
+
+    int epoll_file_descriptor = epoll_create1(0);
+    if (epoll_file_descriptor < 0)
+    {
+        perror("epoll_create1");
+        close(publisher_socket_fd);
+        for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+        {
+            close(subscriber_array[subscriber_index].socket_file_descriptor);
+            free(subscriber_array[subscriber_index].send_queue);
+            free(subscriber_array[subscriber_index].release_queue);
+        }
+        free(subscriber_array);
+        return 1;
+    }
+    struct epoll_event registration_event;
+    memset(&registration_event, 0, sizeof(registration_event));
+    registration_event.events = EPOLLIN;
+    registration_event.data.u32 = 0;
+    epoll_ctl(epoll_file_descriptor, EPOLL_CTL_ADD, publisher_socket_fd, &registration_event);
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        fcntl(subscriber_array[subscriber_index].socket_file_descriptor, F_SETFL,
+              fcntl(subscriber_array[subscriber_index].socket_file_descriptor, F_GETFL) | O_NONBLOCK);
+        registration_event.events = 0;
+        registration_event.data.u32 = (uint32_t)subscriber_index + 1;
+        epoll_ctl(epoll_file_descriptor, EPOLL_CTL_ADD, subscriber_array[subscriber_index].socket_file_descriptor, &registration_event);
+    }
+    fcntl(publisher_socket_fd, F_SETFL, fcntl(publisher_socket_fd, F_GETFL) | O_NONBLOCK);
+
+    uint64_t published_message_count = 0;
+    pubsub_buffer_t *incoming_buffer_ptr = NULL;
+    size_t incoming_bytes = 0;
+    int publisher_open = 1;
+    int publisher_paused = 0;
+    uint64_t start_time_ns = now_ns();
+    uint64_t drain_deadline_ns = 0;
+    struct epoll_event ready_events[PUBSUB_MAX_EVENTS];
+    for (;;)
+    {
+        int blocked_by_subscriber = 0;
+        int pending_subscriber_work = 0;
+        for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+        {
+            pubsub_subscriber_t *subscriber_ptr = &subscriber_array[subscriber_index];
+            if (!subscriber_ptr->connected)
+            {
+                continue;
+            }
+            if (server_config->pubsub_drop_policy == PUBSUB_BLOCK && subscriber_ptr->queue_count >= queue_capacity)
+            {
+                blocked_by_subscriber = 1;
+            }
+            if (subscriber_ptr->queue_count > 0 || subscriber_ptr->release_count > 0)
+            {
+                pending_subscriber_work = 1;
+            }
+        }
+        if (publisher_open && blocked_by_subscriber != publisher_paused)
+        {
+            registration_event.events = blocked_by_subscriber ? 0 : EPOLLIN;
+            registration_event.data.u32 = 0;
+            epoll_ctl(epoll_file_descriptor, EPOLL_CTL_MOD, publisher_socket_fd, &registration_event);
+            publisher_paused = blocked_by_subscriber;
+        }
+        if (!publisher_open && !pending_subscriber_work)
+        {
+            break;
+        }
+        if (!publisher_open && drain_deadline_ns && now_ns() >= drain_deadline_ns)
+        {
+            break;
+        }
+
+        int ready_count = epoll_wait(epoll_file_descriptor, ready_events, PUBSUB_MAX_EVENTS, PUBSUB_WAIT_MILLISECONDS);
+        if (ready_count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        for (int event_index = 0; event_index < ready_count; event_index++)
+        {
+            uint32_t event_key = ready_events[event_index].data.u32;
+            if (event_key > 0)
+            {
+                int subscriber_index = (int)event_key - 1;
+                pubsub_subscriber_t *subscriber_ptr = &subscriber_array[subscriber_index];
+                if (ready_events[event_index].events & EPOLLERR)
+                {
+                    pubsub_reap_completions(&buffer_pool, subscriber_ptr);
+                }
+                pubsub_flush_subscriber(&buffer_pool, epoll_file_descriptor, subscriber_ptr, subscriber_index, queue_capacity);
+                continue;
+            }
+
+            for (int read_index = 0; read_index < PUBSUB_READS_PER_WAKEUP && publisher_open && !publisher_paused; read_index++)
+            {
+                if (!incoming_buffer_ptr)
+                {
+                    incoming_buffer_ptr = pubsub_buffer_acquire(&buffer_pool);
+                    incoming_bytes = 0;
+                    if (!incoming_buffer_ptr)
+                    {
+                        break;
+                    }
+                }
+                ssize_t receive_result = recv(publisher_socket_fd, incoming_buffer_ptr->payload + incoming_bytes, server_config->message_size - incoming_bytes, 0);
+                if (receive_result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+                {
+                    break;
+                }
+                if (receive_result <= 0)
+                {
+                    epoll_ctl(epoll_file_descriptor, EPOLL_CTL_DEL, publisher_socket_fd, NULL);
+                    close(publisher_socket_fd);
+                    publisher_open = 0;
+                    drain_deadline_ns = now_ns() + PUBSUB_DRAIN_TIMEOUT_NANOSECONDS;
+                    break;
+                }
+                incoming_bytes += (size_t)receive_result;
+                if (incoming_bytes < server_config->message_size)
+                {
+                    continue;
+                }
+                published_message_count++;
+                int blocked_after_enqueue = 0;
+                for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+                {
+                    pubsub_subscriber_t *subscriber_ptr = &subscriber_array[subscriber_index];
+                    if (pubsub_enqueue(&buffer_pool, subscriber_ptr, incoming_buffer_ptr, server_config->pubsub_drop_policy, queue_capacity))
+                    {
+                        pubsub_flush_subscriber(&buffer_pool, epoll_file_descriptor, subscriber_ptr, subscriber_index, queue_capacity);
+                    }
+                    if (server_config->pubsub_drop_policy == PUBSUB_BLOCK && subscriber_ptr->connected && subscriber_ptr->queue_count >= queue_capacity)
+                    {
+                        blocked_after_enqueue = 1;
+                    }
+                }
+                pubsub_buffer_release(&buffer_pool, incoming_buffer_ptr);
+                incoming_buffer_ptr = NULL;
+                if (blocked_after_enqueue)
+                {
+                    break;
+                }
+            }
+        }
+    }
+    double elapsed_time_seconds = (double)(now_ns() - start_time_ns) / 1e9;
+
+    uint64_t delivered_message_count = 0;
+    uint64_t dropped_message_count = 0;
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        delivered_message_count += subscriber_array[subscriber_index].sent_message_count;
+        dropped_message_count += subscriber_array[subscriber_index].dropped_message_count;
+    }
+    int zerocopy_subscriber_count = 0;
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        zerocopy_subscriber_count += subscriber_array[subscriber_index].zerocopy_enabled;
+    }
+    printf("SERVER_PUBSUB,%d,%s,%d,%d,%llu,%llu,%llu,%llu,%.6f\n",
+           subscriber_count,
+           pubsub_drop_policy_name(server_config->pubsub_drop_policy),
+           queue_capacity,
+           zerocopy_subscriber_count == subscriber_count ? 1 : 0,
+           (unsigned long long)published_message_count,
+           (unsigned long long)delivered_message_count,
+           (unsigned long long)dropped_message_count,
+           (unsigned long long)buffer_pool.peak_outstanding_buffer_count,
+           elapsed_time_seconds > 0.0 ? (double)delivered_message_count * (double)server_config->message_size * 8.0 / (elapsed_time_seconds * 1e9) : 0.0);
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        pubsub_subscriber_t *subscriber_ptr = &subscriber_array[subscriber_index];
+        printf("SERVER_SUBSCRIBER,%d,%llu,%llu,%d\n",
+               subscriber_index,
+               (unsigned long long)subscriber_ptr->sent_message_count,
+               (unsigned long long)subscriber_ptr->dropped_message_count,
+               subscriber_ptr->peak_queue_count);
+        pubsub_disconnect_subscriber(&buffer_pool, epoll_file_descriptor, subscriber_ptr, queue_capacity);
+        free(subscriber_ptr->send_queue);
+        free(subscriber_ptr->release_queue);
+    }
+    if (incoming_buffer_ptr)
+    {
+        pubsub_buffer_release(&buffer_pool, incoming_buffer_ptr);
+    }
+    if (publisher_open)
+    {
+        close(publisher_socket_fd);
+    }
+    close(epoll_file_descriptor);
+    pubsub_buffer_pool_destroy(&buffer_pool);
+    free(subscriber_array);
+    return 0;
+}
+
+static void *pubsub_subscriber_main(void *thread_argument)
+{
+    pubsub_subscriber_context_t *subscriber_context = (pubsub_subscriber_context_t *)thread_argument;
+    const client_config_t *client_config = subscriber_context->client_config;
+    if (client_config->cpu_pin_base >= 0)
+    {
+        pin_thread(client_config->cpu_pin_base + subscriber_context->subscriber_index);
+    }
+    char *receive_buffer = (char *)malloc(client_config->message_size);
+    if (!receive_buffer)
+    {
+        return NULL;
+    }
+    int slow_subscriber = subscriber_context->subscriber_index < client_config->pubsub_slow_subscriber_count;
+    struct timespec slow_delay = {0, (long)client_config->pubsub_slow_delay_microseconds * 1000L};
+    uint64_t expected_sequence_number = 0;
+    while (read_full(subscriber_context->socket_file_descriptor, receive_buffer, client_config->message_size) > 0)
+    {
+        uint64_t delivery_time_ns = now_ns();
+        uint64_t sequence_number;
+        uint64_t publish_time_ns;
+        memcpy(&sequence_number, receive_buffer, sizeof(sequence_number));
+        memcpy(&publish_time_ns, receive_buffer + sizeof(sequence_number), sizeof(publish_time_ns));
+        if (sequence_number > expected_sequence_number)
+        {
+            subscriber_context->missing_message_count += sequence_number - expected_sequence_number;
+        }
+        expected_sequence_number = sequence_number + 1;
+        uint64_t delivery_latency_ns = delivery_time_ns > publish_time_ns ? delivery_time_ns - publish_time_ns : 0;
+        subscriber_context->delivered_message_count++;
+        subscriber_context->delivery_latency_sum_ns += delivery_latency_ns;
+        latency_histogram_record(&subscriber_context->delivery_histogram, delivery_latency_ns);
+        if (slow_subscriber && slow_delay.tv_nsec > 0)
+        {
+            nanosleep(&slow_delay, NULL);
+        }
+    }
+    free(receive_buffer);
+    return NULL;
+}
+
+static void *pubsub_publisher_main(void *thread_argument)
+{
+    pubsub_publisher_context_t *publisher_context = (pubsub_publisher_context_t *)thread_argument;
+    const client_config_t *client_config = publisher_context->client_config;
+    if (client_config->cpu_pin_base >= 0)
+    {
+        pin_thread(client_config->cpu_pin_base + client_config->pubsub_subscriber_count);
+    }
+    message_t source_message;
+    message_init(&source_message, client_config->message_size);
+    char *send_packed_buffer = (char *)malloc(client_config->message_size);
+    if (!send_packed_buffer)
+    {
+        message_free(&source_message);
+        return NULL;
+    }
+    message_pack(&source_message, send_packed_buffer);
+
+    uint64_t publish_interval_ns = client_config->pubsub_publish_rate > 0 ? 1000000000ULL / (uint64_t)client_config->pubsub_publish_rate : 0;
+    uint64_t duration_nanoseconds = (uint64_t)client_config->duration_seconds * 1000000000ULL;
+    uint64_t operation_start_time_ns = now_ns();
+    uint64_t current_time_ns = operation_start_time_ns;
+    while (current_time_ns - operation_start_time_ns < duration_nanoseconds)
+    {
+        if (publish_interval_ns)
+        {
+            uint64_t scheduled_time_ns = operation_start_time_ns + publisher_context->published_message_count * publish_interval_ns;
+            if (scheduled_time_ns > current_time_ns)
+            {
+                struct timespec pacing_delay = {(time_t)((scheduled_time_ns - current_time_ns) / 1000000000ULL), (long)((scheduled_time_ns - current_time_ns) % 1000000000ULL)};
+                nanosleep(&pacing_delay, NULL);
+            }
+        }
+        uint64_t sequence_number = publisher_context->published_message_count;
+        uint64_t publish_time_ns = now_ns();
+        memcpy(send_packed_buffer, &sequence_number, sizeof(sequence_number));
+        memcpy(send_packed_buffer + sizeof(sequence_number), &publish_time_ns, sizeof(publish_time_ns));
+        if (write_full(publisher_context->socket_file_descriptor, send_packed_buffer, client_config->message_size) <= 0)
+        {
+            break;
+        }
+        publisher_context->published_message_count++;
+        current_time_ns = now_ns();
+    }
+    publisher_context->elapsed_nanoseconds = now_ns() - operation_start_time_ns;
+    close(publisher_context->socket_file_descriptor);
+    message_free(&source_message);
+    free(send_packed_buffer);
+    return NULL;
+}
+
+static int pubsub_connect_role(const client_config_t *client_config, char connection_role)
+{
+    int socket_file_descriptor = create_client_socket(client_config->hostname, client_config->port_number);
+    if (socket_file_descriptor < 0)
+    {
+        return -1;
+    }
+    if (write_full(socket_file_descriptor, &connection_role, 1) <= 0)
+    {
+        close(socket_file_descriptor);
+        return -1;
+    }
+    return socket_file_descriptor;
+}
+
+int run_pubsub_client(const client_config_t *client_config)
+{
+    int subscriber_count = client_config->pubsub_subscriber_count;
+    pthread_t *subscriber_thread_array = (pthread_t *)calloc((size_t)subscriber_count, sizeof(pthread_t));
+    pubsub_subscriber_context_t *subscriber_context_array = (pubsub_subscriber_context_t *)calloc((size_t)subscriber_count, sizeof(pubsub_subscriber_context_t));
+    latency_histogram_t *aggregated_histogram = (latency_histogram_t *)calloc(1, sizeof(latency_histogram_t));
+    if (!subscriber_thread_array || !subscriber_context_array || !aggregated_histogram)
+    {
+        free(subscriber_thread_array);
+        free(subscriber_context_array);
+        free(aggregated_histogram);
+        return 1;
+    }
+
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        subscriber_context_array[subscriber_index].client_config = client_config;
+        subscriber_context_array[subscriber_index].subscriber_index = subscriber_index;
+        subscriber_context_array[subscriber_index].socket_file_descriptor = pubsub_connect_role(client_config, PUBSUB_ROLE_SUBSCRIBER);
+        if (subscriber_context_array[subscriber_index].socket_file_descriptor < 0)
+        {
+            perror("subscriber connect");
+            return 1;
+        }
+    }
+    pubsub_publisher_context_t publisher_context;
+    memset(&publisher_context, 0, sizeof(publisher_context));
+    publisher_context.client_config = client_config;
+    publisher_context.socket_file_descriptor = pubsub_connect_role(client_config, PUBSUB_ROLE_PUBLISHER);
+    if (publisher_context.socket_file_descriptor < 0)
+    {
+        perror("publisher connect");
+        return 1;
+    }
+
+    uint64_t start_time_ns = now_ns();
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        pthread_create(&subscriber_thread_array[subscriber_index], NULL, pubsub_subscriber_main, &subscriber_context_array[subscriber_index]);
+    }
+    pthread_t publisher_thread;
+    pthread_create(&publisher_thread, NULL, pubsub_publisher_main, &publisher_context);
+    pthread_join(publisher_thread, NULL);
+
+    uint64_t delivered_message_count = 0;
+    uint64_t missing_message_count = 0;
+    uint64_t delivery_latency_sum_ns = 0;
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        pubsub_subscriber_context_t *subscriber_context = &subscriber_context_array[subscriber_index];
+        pthread_join(subscriber_thread_array[subscriber_index], NULL);
+        close(subscriber_context->socket_file_descriptor);
+        delivered_message_count += subscriber_context->delivered_message_count;
+        missing_message_count += subscriber_context->missing_message_count;
+        delivery_latency_sum_ns += subscriber_context->delivery_latency_sum_ns;
+        latency_histogram_merge(aggregated_histogram, &subscriber_context->delivery_histogram);
+    }
+    uint64_t elapsed_nanoseconds = now_ns() - start_time_ns;
+    double elapsed_time_seconds = (double)elapsed_nanoseconds / 1e9;
+
+    report_result(MODE_LATENCY, delivered_message_count * client_config->message_size, delivered_message_count, delivery_latency_sum_ns, elapsed_nanoseconds);
+    printf("PUBSUB,%d,%llu,%llu,%llu,%.1f\n",
+           subscriber_count,
+           (unsigned long long)publisher_context.published_message_count,
+           (unsigned long long)delivered_message_count,
+           (unsigned long long)missing_message_count,
+           elapsed_time_seconds > 0.0 ? (double)delivered_message_count / elapsed_time_seconds : 0.0);
+    report_latency_percentiles("DELIVERY_PERCENTILES", aggregated_histogram);
+    for (int subscriber_index = 0; subscriber_index < subscriber_count; subscriber_index++)
+    {
+        pubsub_subscriber_context_t *subscriber_context = &subscriber_context_array[subscriber_index];
+        char subscriber_line_prefix[96];
+        snprintf(subscriber_line_prefix, sizeof(subscriber_line_prefix), "SUBSCRIBER,%d,%llu,%llu",
+                 subscriber_index,
+                 (unsigned long long)subscriber_context->delivered_message_count,
+                 (unsigned long long)subscriber_context->missing_message_count);
+        report_latency_percentiles(subscriber_line_prefix, &subscriber_context->delivery_histogram);
+    }
+
+    free(aggregated_histogram);
+    free(subscriber_thread_array);
+    free(subscriber_context_array);
+    return 0;
+}
@@ -0,0 +1,119 @@
+#ifndef MT25041_PART_RING_H
+#define MT25041_PART_RING_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define CACHE_LINE_SIZE 64
+
+typedef struct
+{
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t consumer_position;
+    size_t cached_producer_position;
+    _Alignas(CACHE_LINE_SIZE) atomic_size_t producer_position;
+    size_t cached_consumer_position;
+    _Alignas(CACHE_LINE_SIZE) atomic_int producer_closed;
+    size_t capacity_mask;
+    void **slot_array;
+    uint64_t depth_sample_sum;
+    uint64_t depth_sample_count;
+    size_t maximum_observed_depth;
+} spsc_ring_t;
+
+static inline size_t spsc_ring_round_capacity(size_t requested_capacity)
+{
+    size_t rounded_capacity = 2;
+    while (rounded_capacity < requested_capacity)
+    {
+        rounded_capacity <<= 1;
+    }
+    return rounded_capacity;
+}
+
+static inline int spsc_ring_init(spsc_ring_t *ring_ptr, size_t requested_capacity)
+{
+    size_t ring_capacity = spsc_ring_round_capacity(requested_capacity);
+    ring_ptr->slot_array = (void **)calloc(ring_capacity, sizeof(void *));
+    if (!ring_ptr->slot_array)
+    {
+        return -1;
+    }
+    ring_ptr->capacity_mask = ring_capacity - 1;
+    atomic_init(&ring_ptr->consumer_position, 0);
+    atomic_init(&ring_ptr->producer_position, 0);
+    atomic_init(&ring_ptr->producer_closed, 0);
+    ring_ptr->cached_producer_position = 0;
+    ring_ptr->cached_consumer_position = 0;
+    ring_ptr->depth_sample_sum = 0;
+    ring_ptr->depth_sample_count = 0;
+    ring_ptr->maximum_observed_depth = 0;
+    return 0;
+}
+
+static inline void spsc_ring_destroy(spsc_ring_t *ring_ptr)
+{
+    free(ring_ptr->slot_array);
+    ring_ptr->slot_array = NULL;
+}
+
+static inline int spsc_ring_push(spsc_ring_t *ring_ptr, void *item_ptr)
+{
+    size_t producer_position = atomic_load_explicit(&ring_ptr->producer_position, memory_order_relaxed);
+    if (producer_position - ring_ptr->cached_consumer_position > ring_ptr->capacity_mask)
+    {
+        ring_ptr->cached_consumer_position = atomic_load_explicit(&ring_ptr->consumer_position, memory_order_acquire);
+        if (producer_position - ring_ptr->cached_consumer_position > ring_ptr->capacity_mask)
+        {
+            return 0;
+        }
+    }
+    ring_ptr->slot_array[producer_position & ring_ptr->capacity_mask] = item_ptr;
+    atomic_store_explicit(&ring_ptr->producer_position, producer_position + 1, memory_order_release);
+    return 1;
+}
+
+static inline size_t spsc_ring_pop_batch(spsc_ring_t *ring_ptr, void **item_array, size_t maximum_items)
+{
+    size_t consumer_position = atomic_load_explicit(&ring_ptr->consumer_position, memory_order_relaxed);
+    if (ring_ptr->cached_producer_position == consumer_position)
+    {
+        ring_ptr->cached_producer_position = atomic_load_explicit(&ring_ptr->producer_position, memory_order_acquire);
+        if (ring_ptr->cached_producer_position == consumer_position)
+        {
+            return 0;
+        }
+    }
+    size_t available_items = ring_ptr->cached_producer_position - consumer_position;
+    ring_ptr->depth_sample_sum += available_items;
+    ring_ptr->depth_sample_count++;
+    if (available_items > ring_ptr->maximum_observed_depth)
+    {
+        ring_ptr->maximum_observed_depth = available_items;
+    }
+    size_t popped_items = (available_items < maximum_items) ? available_items : maximum_items;
+    for (size_t item_index = 0; item_index < popped_items; item_index++)
+    {
+        item_array[item_index] = ring_ptr->slot_array[(consumer_position + item_index) & ring_ptr->capacity_mask];
+    }
+    atomic_store_explicit(&ring_ptr->consumer_position, consumer_position + popped_items, memory_order_release);
+    return popped_items;
+}
+
+static inline void spsc_ring_close(spsc_ring_t *ring_ptr)
+{
+    atomic_store_explicit(&ring_ptr->producer_closed, 1, memory_order_release);
+}
+
+static inline int spsc_ring_is_drained(spsc_ring_t *ring_ptr)
+{
+    if (!atomic_load_explicit(&ring_ptr->producer_closed, memory_order_acquire))
+    {
+        return 0;
+    }
+    return atomic_load_explicit(&ring_ptr->producer_position, memory_order_acquire) ==
+           atomic_load_explicit(&ring_ptr->consumer_position, memory_order_relaxed);
+}
+
+#endif
@@ -0,0 +1,447 @@
+#include "MT25041_Part_Common.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+#define SAMPLER_TCP_COUNTER_COUNT 10
+
+typedef struct
+{
+    struct tcp_info base_info;
+    uint64_t tcpi_pacing_rate;
+    uint64_t tcpi_max_pacing_rate;
+    uint64_t tcpi_bytes_acked;
+    uint64_t tcpi_bytes_received;
+    uint32_t tcpi_segs_out;
+    uint32_t tcpi_segs_in;
+    uint32_t tcpi_notsent_bytes;
+    uint32_t tcpi_min_rtt;
+} sampler_tcp_info_t;
+
+typedef struct
+{
+    uint64_t softirq_jiffies;
+    uint64_t net_rx_count;
+    uint64_t net_tx_count;
+} sampler_cpu_counters_t;
+
+typedef struct
+{
+    const char *table_name;
+    const char *counter_name;
+} sampler_tcp_counter_source_t;
+
+static const sampler_tcp_counter_source_t sampler_tcp_counter_sources[SAMPLER_TCP_COUNTER_COUNT] = {
+    {"Tcp:", "InSegs"},
+    {"Tcp:", "OutSegs"},
+    {"Tcp:", "RetransSegs"},
+    {"TcpExt:", "TCPFastRetrans"},
+    {"TcpExt:", "TCPTimeouts"},
+    {"TcpExt:", "TCPLostRetransmit"},
+    {"TcpExt:", "TCPBacklogDrop"},
+    {"TcpExt:", "TCPRcvQDrop"},
+    {"TcpExt:", "PruneCalled"},
+    {"TcpExt:", "TCPRcvCollapsed"}};
+
+struct kernel_sampler
+{
+    char line_prefix[32];
+    uint64_t interval_nanoseconds;
+    int maximum_socket_count;
+    int *socket_file_descriptors;
+    const uint64_t **byte_counter_pointers;
+    atomic_int registered_socket_count;
+    int cpu_count;
+    sampler_cpu_counters_t *previous_cpu_counters;
+    sampler_cpu_counters_t *current_cpu_counters;
+    uint64_t previous_tcp_counters[SAMPLER_TCP_COUNTER_COUNT];
+    uint64_t current_tcp_counters[SAMPLER_TCP_COUNTER_COUNT];
+    uint64_t previous_total_bytes;
+    uint64_t start_time_ns;
+    uint64_t previous_time_ns;
+    long clock_ticks_per_second;
+    char *record_buffer;
+    size_t record_buffer_length;
+    FILE *record_stream;
+    pthread_mutex_t socket_mutex;
+    pthread_mutex_t stop_mutex;
+    pthread_cond_t stop_condition;
+    int stop_requested;
+    pthread_t sampler_thread;
+};
+
+static void sampler_read_cpu_counters(kernel_sampler_t *sampler_ptr, sampler_cpu_counters_t *cpu_counters)
+{
+    memset(cpu_counters, 0, (size_t)sampler_ptr->cpu_count * sizeof(sampler_cpu_counters_t));
+    char line_buffer[4096];
+
+    FILE *stat_file = fopen("/proc/stat", "r");
+    if (stat_file)
+    {
+        while (fgets(line_buffer, sizeof(line_buffer), stat_file))
+        {
+            if (strncmp(line_buffer, "cpu", 3) != 0 || line_buffer[3] < '0' || line_buffer[3] > '9')
+            {
+                continue;
+            }
+            int cpu_index = -1;
+            unsigned long long user_jiffies, nice_jiffies, system_jiffies, idle_jiffies, iowait_jiffies, irq_jiffies, softirq_jiffies;
+            if (sscanf(line_buffer, "cpu%d %llu %llu %llu %llu %llu %llu %llu",
+                       &cpu_index, &user_jiffies, &nice_jiffies, &system_jiffies, &idle_jiffies, &iowait_jiffies, &irq_jiffies, &softirq_jiffies) == 8 &&
+                cpu_index >= 0 && cpu_index < sampler_ptr->cpu_count)
+            {
+                cpu_counters[cpu_index].softirq_jiffies = softirq_jiffies;
+            }
+        }
+        fclose(stat_file);
+    }
+
+    FILE *softirq_file = fopen("/proc/softirqs", "r");
+    if (!softirq_file)
+    {
+        return;
+    }
+    while (fgets(line_buffer, sizeof(line_buffer), softirq_file))
+    {
+        char *cursor_ptr = line_buffer;
+        while (*cursor_ptr == ' ')
+        {
+            cursor_ptr++;
+        }
+        int is_receive = strncmp(cursor_ptr, "NET_RX:", 7) == 0;
+        int is_transmit = strncmp(cursor_ptr, "NET_TX:", 7) == 0;
+        if (!is_receive && !is_transmit)
+        {
+            continue;
+        }
+        cursor_ptr += 7;
+        for (int cpu_index = 0; cpu_index < sampler_ptr->cpu_count; cpu_index++)
+        {
+            char *end_pointer = NULL;
+            unsigned long long event_count = strtoull(cursor_ptr, &end_pointer, 10);
+            if (end_pointer == cursor_ptr)
+            {
+                break;
+            }
+            if (is_receive)
+            {
+                cpu_counters[cpu_index].net_rx_count = event_count;
+            }
+            else
+            {
+                cpu_counters[cpu_index].net_tx_count = event_count;
+            }
+            cursor_ptr = end_pointer;
+        }
+    }
+    fclose(softirq_file);
+}
+
+static void sampler_read_tcp_table(const char *proc_path, uint64_t *tcp_counters)
+{
+    FILE *table_file = fopen(proc_path, "r");
+    if (!table_file)
+    {
+        return;
+    }
+    char header_line[8192];
+    char value_line[8192];
+    while (fgets(header_line, sizeof(header_line), table_file) && fgets(value_line, sizeof(value_line), table_file))
+    {
+        char *header_save_ptr = NULL;
+        char *value_save_ptr = NULL;
+        char *table_name = strtok_r(header_line, " \n", &header_save_ptr);
+        strtok_r(value_line, " \n", &value_save_ptr);
+        if (!table_name)
+        {
+            continue;
+        }
+        char *counter_name;
+        while ((counter_name = strtok_r(NULL, " \n", &header_save_ptr)) != NULL)
+        {
+            char *counter_value = strtok_r(NULL, " \n", &value_save_ptr);
+            if (!counter_value)
+            {
+                break;
+            }
+            for (int counter_index = 0; counter_index < SAMPLER_TCP_COUNTER_COUNT; counter_index++)
+            {
+                if (strcmp(table_name, sampler_tcp_counter_sources[counter_index].table_name) == 0 &&
+                    strcmp(counter_name, sampler_tcp_counter_sources[counter_index].counter_name) == 0)
+                {
+                    tcp_counters[counter_index] = strtoull(counter_value, NULL, 10);
+                }
+            }
+        }
+    }
+    fclose(table_file);
+}
+
+static void sampler_read_tcp_counters(uint64_t *tcp_counters)
+{
+    memset(tcp_counters, 0, SAMPLER_TCP_COUNTER_COUNT * sizeof(uint64_t));
+    sampler_read_tcp_table("/proc/net/snmp", tcp_counters);
+    sampler_read_tcp_table("/proc/net/netstat", tcp_counters);
+}
+
+static uint64_t sampler_total_bytes(kernel_sampler_t *sampler_ptr, int socket_count)
+{
+    uint64_t total_bytes = 0;
+    for (int socket_index = 0; socket_index < socket_count; socket_index++)
+    {
+        if (sampler_ptr->byte_counter_pointers[socket_index])
+        {
+            total_bytes += __atomic_load_n(sampler_ptr->byte_counter_pointers[socket_index], __ATOMIC_RELAXED);
+        }
+    }
+    return total_bytes;
+}
+
+static void sampler_take_sample(kernel_sampler_t *sampler_ptr)
+{
+    uint64_t sample_time_ns = now_ns();
+    int socket_count = atomic_load_explicit(&sampler_ptr->registered_socket_count, memory_order_acquire);
+    uint64_t total_bytes = sampler_total_bytes(sampler_ptr, socket_count);
+    sampler_read_cpu_counters(sampler_ptr, sampler_ptr->current_cpu_counters);
+    sampler_read_tcp_counters(sampler_ptr->current_tcp_counters);
+
+    double elapsed_milliseconds = (double)(sample_time_ns - sampler_ptr->start_time_ns) / 1e6;
+    double interval_milliseconds = (double)(sample_time_ns - sampler_ptr->previous_time_ns) / 1e6;
+    uint64_t interval_bytes = total_bytes - sampler_ptr->previous_total_bytes;
+    double interval_gbps = interval_milliseconds > 0.0 ? ((double)interval_bytes * 8.0) / (interval_milliseconds * 1e6) : 0.0;
+    double milliseconds_per_jiffy = 1000.0 / (double)sampler_ptr->clock_ticks_per_second;
+
+    uint64_t softirq_jiffies_delta = 0;
+    uint64_t net_rx_delta = 0;
+    uint64_t net_tx_delta = 0;
+    for (int cpu_index = 0; cpu_index < sampler_ptr->cpu_count; cpu_index++)
+    {
+        sampler_cpu_counters_t *current_ptr = &sampler_ptr->current_cpu_counters[cpu_index];
+        sampler_cpu_counters_t *previous_ptr = &sampler_ptr->previous_cpu_counters[cpu_index];
+        uint64_t cpu_softirq_delta = current_ptr->softirq_jiffies - previous_ptr->softirq_jiffies;
+        uint64_t cpu_net_rx_delta = current_ptr->net_rx_count - previous_ptr->net_rx_count;
+        uint64_t cpu_net_tx_delta = current_ptr->net_tx_count - previous_ptr->net_tx_count;
+        softirq_jiffies_delta += cpu_softirq_delta;
+        net_rx_delta += cpu_net_rx_delta;
+        net_tx_delta += cpu_net_tx_delta;
+        if (cpu_softirq_delta || cpu_net_rx_delta || cpu_net_tx_delta)
+        {
+            fprintf(sampler_ptr->record_stream, "%s_CPU,%.3f,%d,%.1f,%llu,%llu\n",
+                    sampler_ptr->line_prefix,
+                    elapsed_milliseconds,
+                    cpu_index,
+                    (double)cpu_softirq_delta * milliseconds_per_jiffy,
+                    (unsigned long long)cpu_net_rx_delta,
+                    (unsigned long long)cpu_net_tx_delta);
+        }
+    }
+
+    fprintf(sampler_ptr->record_stream, "%s,%.3f,%.3f,%llu,%.6f,%.1f,%llu,%llu",
+            sampler_ptr->line_prefix,
+            elapsed_milliseconds,
+            interval_milliseconds,
+            (unsigned long long)interval_bytes,
+            interval_gbps,
+            (double)softirq_jiffies_delta * milliseconds_per_jiffy,
+            (unsigned long long)net_rx_delta,
+            (unsigned long long)net_tx_delta);
+    for (int counter_index = 0; counter_index < SAMPLER_TCP_COUNTER_COUNT; counter_index++)
+    {
+        fprintf(sampler_ptr->record_stream, ",%llu",
+                (unsigned long long)(sampler_ptr->current_tcp_counters[counter_index] - sampler_ptr->previous_tcp_counters[counter_index]));
+    }
+    fputc('\n', sampler_ptr->record_stream);
+
+    pthread_mutex_lock(&sampler_ptr->socket_mutex);
+    for (int socket_index = 0; socket_index < socket_count; socket_index++)
+    {
+        if (sampler_ptr->socket_file_descriptors[socket_index] < 0)
+        {
+            continue;
+        }
+        sampler_tcp_info_t tcp_information;
+        memset(&tcp_information, 0, sizeof(tcp_information));
+        socklen_t information_length = sizeof(tcp_information);
+        if (getsockopt(sampler_ptr->socket_file_descriptors[socket_index], IPPROTO_TCP, TCP_INFO, &tcp_information, &information_length) != 0)
+        {
+            continue;
+        }
+        uint32_t notsent_bytes = 0;
+        if (information_length >= offsetof(sampler_tcp_info_t, tcpi_notsent_bytes) + sizeof(uint32_t))
+        {
+            notsent_bytes = tcp_information.tcpi_notsent_bytes;
+        }
+        fprintf(sampler_ptr->record_stream, "%s_SOCKET,%.3f,%d,%u,%u,%u,%u,%u,%u\n",
+                sampler_ptr->line_prefix,
+                elapsed_milliseconds,
+                socket_index,
+                tcp_information.base_info.tcpi_rtt,
+                tcp_information.base_info.tcpi_rttvar,
+                tcp_information.base_info.tcpi_snd_cwnd,
+                tcp_information.base_info.tcpi_unacked,
+                notsent_bytes,
+                tcp_information.base_info.tcpi_total_retrans);
+    }
+    pthread_mutex_unlock(&sampler_ptr->socket_mutex);
+
+    sampler_cpu_counters_t *swap_counters = sampler_ptr->previous_cpu_counters;
+    sampler_ptr->previous_cpu_counters = sampler_ptr->current_cpu_counters;
+    sampler_ptr->current_cpu_counters = swap_counters;
+    memcpy(sampler_ptr->previous_tcp_counters, sampler_ptr->current_tcp_counters, sizeof(sampler_ptr->previous_tcp_counters));
+    sampler_ptr->previous_total_bytes = total_bytes;
+    sampler_ptr->previous_time_ns = sample_time_ns;
+}
+
+static void *sampler_thread_main(void *thread_argument)
+{
+    kernel_sampler_t *sampler_ptr = (kernel_sampler_t *)thread_argument;
+    uint64_t next_sample_time_ns = sampler_ptr->start_time_ns;
+    pthread_mutex_lock(&sampler_ptr->stop_mutex);
+    while (!sampler_ptr->stop_requested)
+    {
+        next_sample_time_ns += sampler_ptr->interval_nanoseconds;
+        struct timespec wake_time;
+        wake_time.tv_sec = (time_t)(next_sample_time_ns / 1000000000ULL);
+        wake_time.tv_nsec = (long)(next_sample_time_ns % 1000000000ULL);
+        while (!sampler_ptr->stop_requested &&
+               pthread_cond_timedwait(&sampler_ptr->stop_condition, &sampler_ptr->stop_mutex, &wake_time) != ETIMEDOUT)
+        {
+        }
+        pthread_mutex_unlock(&sampler_ptr->stop_mutex);
+        sampler_take_sample(sampler_ptr);
+        pthread_mutex_lock(&sampler_ptr->stop_mutex);
+    }
+    pthread_mutex_unlock(&sampler_ptr->stop_mutex);
+    return NULL;
+}
+
+kernel_sampler_t *kernel_sampler_start(const char *line_prefix, int interval_milliseconds, int maximum_socket_count)
+{
+    kernel_sampler_t *sampler_ptr = (kernel_sampler_t *)calloc(1, sizeof(kernel_sampler_t));
+    if (!sampler_ptr)
+    {
+        return NULL;
+    }
+    snprintf(sampler_ptr->line_prefix, sizeof(sampler_ptr->line_prefix), "%s", line_prefix);
+    sampler_ptr->interval_nanoseconds = (uint64_t)interval_milliseconds * 1000000ULL;
+    sampler_ptr->maximum_socket_count = maximum_socket_count;
+    atomic_init(&sampler_ptr->registered_socket_count, 0);
+    sampler_ptr->cpu_count = (int)sysconf(_SC_NPROCESSORS_CONF);
+    sampler_ptr->clock_ticks_per_second = sysconf(_SC_CLK_TCK);
+    if (sampler_ptr->cpu_count < 1)
+    {
+        sampler_ptr->cpu_count = 1;
+    }
+    if (sampler_ptr->clock_ticks_per_second < 1)
+    {
+        sampler_ptr->clock_ticks_per_second = 100;
+    }
+    sampler_ptr->socket_file_descriptors = (int *)calloc((size_t)maximum_socket_count + 1, sizeof(int));
+    sampler_ptr->byte_counter_pointers = (const uint64_t **)calloc((size_t)maximum_socket_count + 1, sizeof(uint64_t *));
+    sampler_ptr->previous_cpu_counters = (sampler_cpu_counters_t *)calloc((size_t)sampler_ptr->cpu_count, sizeof(sampler_cpu_counters_t));
+    sampler_ptr->current_cpu_counters = (sampler_cpu_counters_t *)calloc((size_t)sampler_ptr->cpu_count, sizeof(sampler_cpu_counters_t));
+    sampler_ptr->record_stream = open_memstream(&sampler_ptr->record_buffer, &sampler_ptr->record_buffer_length);
+    if (!sampler_ptr->socket_file_descriptors || !sampler_ptr->byte_counter_pointers ||
+        !sampler_ptr->previous_cpu_counters || !sampler_ptr->current_cpu_counters || !sampler_ptr->record_stream)
+    {
+        if (sampler_ptr->record_stream)
+        {
+            fclose(sampler_ptr->record_stream);
+        }
+        free(sampler_ptr->record_buffer);
+        free(sampler_ptr->socket_file_descriptors);
+        free(sampler_ptr->byte_counter_pointers);
+        free(sampler_ptr->previous_cpu_counters);
+        free(sampler_ptr->current_cpu_counters);
+        free(sampler_ptr);
+        return NULL;
+    }
+
+    pthread_condattr_t condition_attributes;
+    pthread_condattr_init(&condition_attributes);
+    pthread_condattr_setclock(&condition_attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&sampler_ptr->stop_condition, &condition_attributes);
+    pthread_condattr_destroy(&condition_attributes);
+    pthread_mutex_init(&sampler_ptr->stop_mutex, NULL);
+    pthread_mutex_init(&sampler_ptr->socket_mutex, NULL);
+
+    sampler_read_cpu_counters(sampler_ptr, sampler_ptr->previous_cpu_counters);
+    sampler_read_tcp_counters(sampler_ptr->previous_tcp_counters);
+    sampler_ptr->start_time_ns = now_ns();
+    sampler_ptr->previous_time_ns = sampler_ptr->start_time_ns;
+    if (pthread_create(&sampler_ptr->sampler_thread, NULL, sampler_thread_main, sampler_ptr) != 0)
+    {
+        pthread_cond_destroy(&sampler_ptr->stop_condition);
+        pthread_mutex_destroy(&sampler_ptr->stop_mutex);
+        pthread_mutex_destroy(&sampler_ptr->socket_mutex);
+        fclose(sampler_ptr->record_stream);
+        free(sampler_ptr->record_buffer);
+        free(sampler_ptr->socket_file_descriptors);
+        free(sampler_ptr->byte_counter_pointers);
+        free(sampler_ptr->previous_cpu_counters);
+        free(sampler_ptr->current_cpu_counters);
+        free(sampler_ptr);
+        return NULL;
+    }
+    return sampler_ptr;
+}
+
+void kernel_sampler_add_socket(kernel_sampler_t *sampler_ptr, int socket_file_descriptor, const uint64_t *byte_counter_ptr)
+{
+    if (!sampler_ptr)
+    {
+        return;
+    }
+    int socket_index = atomic_load_explicit(&sampler_ptr->registered_socket_count, memory_order_relaxed);
+    if (socket_index >= sampler_ptr->maximum_socket_count)
+    {
+        return;
+    }
+    sampler_ptr->socket_file_descriptors[socket_index] = socket_file_descriptor;
+    sampler_ptr->byte_counter_pointers[socket_index] = byte_counter_ptr;
+    atomic_store_explicit(&sampler_ptr->registered_socket_count, socket_index + 1, memory_order_release);
+}
+
+void kernel_sampler_remove_socket(kernel_sampler_t *sampler_ptr, int socket_file_descriptor)
+{
+    if (!sampler_ptr)
+    {
+        return;
+    }
+    int socket_count = atomic_load_explicit(&sampler_ptr->registered_socket_count, memory_order_acquire);
+    pthread_mutex_lock(&sampler_ptr->socket_mutex);
+    for (int socket_index = 0; socket_index < socket_count; socket_index++)
+    {
+        if (sampler_ptr->socket_file_descriptors[socket_index] == socket_file_descriptor)
+        {
+            sampler_ptr->socket_file_descriptors[socket_index] = -1;
+        }
+    }
+    pthread_mutex_unlock(&sampler_ptr->socket_mutex);
+}
+
+void kernel_sampler_stop(kernel_sampler_t *sampler_ptr)
+{
+    if (!sampler_ptr)
+    {
+        return;
+    }
+    pthread_mutex_lock(&sampler_ptr->stop_mutex);
+    sampler_ptr->stop_requested = 1;
+    pthread_cond_signal(&sampler_ptr->stop_condition);
+    pthread_mutex_unlock(&sampler_ptr->stop_mutex);
+    pthread_join(sampler_ptr->sampler_thread, NULL);
+
+    fclose(sampler_ptr->record_stream);
+    fwrite(sampler_ptr->record_buffer, 1, sampler_ptr->record_buffer_length, stdout);
+
+    pthread_cond_destroy(&sampler_ptr->stop_condition);
+    pthread_mutex_destroy(&sampler_ptr->stop_mutex);
+    pthread_mutex_destroy(&sampler_ptr->socket_mutex);
+    free(sampler_ptr->record_buffer);
+    free(sampler_ptr->socket_file_descriptors);
+    free(sampler_ptr->byte_counter_pointers);
+    free(sampler_ptr->previous_cpu_counters);
+    free(sampler_ptr->current_cpu_counters);
+    free(sampler_ptr);
+}
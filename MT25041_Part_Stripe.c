@@ -0,0 +1,414 @@
+#include "MT25041_Part_Common.h"
+
+#include <stdatomic.h>
+
+#define STRIPE_VERIFY_INTERVAL 64
+
+typedef struct
+{
+    uint64_t message_id;
+    uint64_t chunk_offset;
+    uint64_t chunk_length;
+} stripe_chunk_header_t;
+
+typedef struct
+{
+    int stripe_index;
+    int socket_file_descriptor;
+    const server_config_t *server_config;
+    char *destination_buffer;
+    atomic_uint_fast64_t *reassembled_bytes_ptr;
+    int acknowledgement_socket_fd;
+    uint64_t completed_message_count;
+    uint64_t received_byte_count;
+    int verification_status;
+} stripe_receiver_context_t;
+
+typedef struct
+{
+    int stripe_index;
+    int socket_file_descriptor;
+    const client_config_t *client_config;
+    enum send_mode send_operation_mode;
+    char *source_buffer;
+    char *staging_buffer;
+    stripe_chunk_header_t *chunk_header_array;
+    pthread_barrier_t *start_barrier_ptr;
+    atomic_int *stop_flag_ptr;
+    uint64_t current_message_id;
+    int zerocopy_enabled;
+    int zerocopy_inflight_count;
+    int send_status;
+} stripe_sender_context_t;
+
+static unsigned char stripe_pattern_byte(size_t byte_offset, uint64_t message_id)
+{
+    return (unsigned char)(((byte_offset * 131u) >> 8) + (message_id / STRIPE_VERIFY_INTERVAL) * 37u);
+}
+
+static int stripe_verify_buffer(const char *destination_buffer, size_t message_size, uint64_t message_id)
+{
+    for (size_t byte_offset = 0; byte_offset < message_size; byte_offset++)
+    {
+        if ((unsigned char)destination_buffer[byte_offset] != stripe_pattern_byte(byte_offset, message_id))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void *stripe_receiver_main(void *thread_argument)
+{
+    stripe_receiver_context_t *receiver_context = (stripe_receiver_context_t *)thread_argument;
+    const server_config_t *server_config = receiver_context->server_config;
+    if (server_config->cpu_pin_base >= 0)
+    {
+        pin_thread(server_config->cpu_pin_base + receiver_context->stripe_index);
+    }
+
+    stripe_chunk_header_t chunk_header;
+    while (read_full(receiver_context->socket_file_descriptor, &chunk_header, sizeof(chunk_header)) > 0)
+    {
+        if (chunk_header.chunk_offset > server_config->message_size || chunk_header.chunk_length > server_config->message_size - chunk_header.chunk_offset)
+        {
+            fprintf(stderr, "stripe %d: chunk [%llu, +%llu) outside the %zu byte message\n", receiver_context->stripe_index,
+                    (unsigned long long)chunk_header.chunk_offset, (unsigned long long)chunk_header.chunk_length, server_config->message_size);
+            break;
+        }
+        if (read_full(receiver_context->socket_file_descriptor, receiver_context->destination_buffer + chunk_header.chunk_offset, chunk_header.chunk_length) <= 0)
+        {
+            break;
+        }
+        receiver_context->received_byte_count += chunk_header.chunk_length;
+        uint64_t reassembled_bytes = atomic_fetch_add(receiver_context->reassembled_bytes_ptr, chunk_header.chunk_length) + chunk_header.chunk_length;
+        if (reassembled_bytes < server_config->message_size)
+        {
+            continue;
+        }
+        atomic_store(receiver_context->reassembled_bytes_ptr, 0);
+        receiver_context->completed_message_count++;
+        if (chunk_header.message_id % STRIPE_VERIFY_INTERVAL == 0 && receiver_context->verification_status >= 0)
+        {
+            receiver_context->verification_status = stripe_verify_buffer(receiver_context->destination_buffer, server_config->message_size, chunk_header.message_id) ? 1 : -1;
+        }
+        if (write_full(receiver_context->acknowledgement_socket_fd, &chunk_header.message_id, sizeof(chunk_header.message_id)) <= 0)
+        {
+            break;
+        }
+    }
+    shutdown(receiver_context->acknowledgement_socket_fd, SHUT_RDWR);
+    return NULL;
+}
+
+int run_stripe_server(const server_config_t *server_config, int listen_socket_fd)
+{
+    int connection_count = server_config->stripe_connection_count;
+    char *destination_buffer = (char *)aligned_alloc(4096, (server_config->message_size + 4095) / 4096 * 4096);
+    pthread_t *receiver_thread_array = (pthread_t *)calloc((size_t)connection_count, sizeof(pthread_t));
+    stripe_receiver_context_t *receiver_context_array = (stripe_receiver_context_t *)calloc((size_t)connection_count, sizeof(stripe_receiver_context_t));
+    if (!destination_buffer || !receiver_thread_array || !receiver_context_array)
+    {
+        free(destination_buffer);
+        free(receiver_thread_array);
+        free(receiver_context_array);
+        return 1;
+    }
+    memset(destination_buffer, 0, server_config->message_size);
+
+    int accepted_connection_count = 0;
+    while (accepted_connection_count < connection_count)
+    {
+        int connection_socket_fd = accept(listen_socket_fd, NULL, NULL);
+        if (connection_socket_fd < 0)
+        {
+            continue;
+        }
+        uint32_t stripe_index;
+        if (read_full(connection_socket_fd, &stripe_index, sizeof(stripe_index)) <= 0 || stripe_index >= (uint32_t)connection_count ||
+            receiver_context_array[stripe_index].server_config)
+        {
+            close(connection_socket_fd);
+            continue;
+        }
+        receiver_context_array[stripe_index].stripe_index = (int)stripe_index;
+        receiver_context_array[stripe_index].socket_file_descriptor = connection_socket_fd;
+        receiver_context_array[stripe_index].server_config = server_config;
+        accepted_connection_count++;
+    }
+    close(listen_socket_fd);
+
+    atomic_uint_fast64_t reassembled_bytes = 0;
+    uint64_t start_time_ns = now_ns();
+    for (int stripe_index = 0; stripe_index < connection_count; stripe_index++)
+    {
+        receiver_context_array[stripe_index].destination_buffer = destination_buffer;
+        receiver_context_array[stripe_index].reassembled_bytes_ptr = &reassembled_bytes;
+        receiver_context_array[stripe_index].acknowledgement_socket_fd = receiver_context_array[0].socket_file_descriptor;
+        pthread_create(&receiver_thread_array[stripe_index], NULL, stripe_receiver_main, &receiver_context_array[stripe_index]);
+    }
+
+    uint64_t completed_message_count = 0;
+    uint64_t received_byte_count = 0;
+    int verification_status = 0;
+    for (int stripe_index = 0; stripe_index < connection_count; stripe_index++)
+    {
+        pthread_join(receiver_thread_array[stripe_index], NULL);
+        completed_message_count += receiver_context_array[stripe_index].completed_message_count;
+        received_byte_count += receiver_context_array[stripe_index].received_byte_count;
+        if (receiver_context_array[stripe_index].verification_status < 0 ||
+            (receiver_context_array[stripe_index].verification_status > 0 && verification_status == 0))
+        {
+            verification_status = receiver_context_array[stripe_index].verification_status;
+        }
+    }
+    double elapsed_time_seconds = (double)(now_ns() - start_time_ns) / 1e9;
+    for (int stripe_index = 0; stripe_index < connection_count; stripe_index++)
+    {
+        close(receiver_context_array[stripe_index].socket_file_descriptor);
+    }
+
+    printf("SERVER_STRIPE,%d,%zu,%llu,%llu,%s,%.6f\n",
+           connection_count,
+           server_config->message_size,
+           (unsigned long long)completed_message_count,
+           (unsigned long long)received_byte_count,
+           verification_status > 0 ? "verified" : (verification_status < 0 ? "mismatch" : "unchecked"),
+           elapsed_time_seconds > 0.0 ? (double)received_byte_count * 8.0 / (elapsed_time_seconds * 1e9) : 0.0);
+    free(destination_buffer);
+    free(receiver_thread_array);
+    free(receiver_context_array);
+    return verification_status < 0 ? 1 : 0;
+}
+
+static int stripe_send_chunk(stripe_sender_context_t *sender_context, const stripe_chunk_header_t *chunk_header_ptr)
+{
+    const char *chunk_payload = sender_context->source_buffer + chunk_header_ptr->chunk_offset;
+    if (sender_context->send_operation_mode == SEND_BASELINE)
+    {
+        memcpy(sender_context->staging_buffer, chunk_payload, chunk_header_ptr->chunk_length);
+        chunk_payload = sender_context->staging_buffer;
+    }
+    struct iovec io_vector_array[2];
+    io_vector_array[0].iov_base = (void *)chunk_header_ptr;
+    io_vector_array[0].iov_len = sizeof(*chunk_header_ptr);
+    io_vector_array[1].iov_base = (void *)chunk_payload;
+    io_vector_array[1].iov_len = chunk_header_ptr->chunk_length;
+
+    int send_flags = MSG_NOSIGNAL;
+#ifdef MSG_ZEROCOPY
+    if (sender_context->zerocopy_enabled)
+    {
+        send_flags |= MSG_ZEROCOPY;
+    }
+#endif
+    int send_call_count = 0;
+    int send_result = sendmsg_full_counted(sender_context->socket_file_descriptor, io_vector_array, 2, send_flags, &send_call_count);
+    if (sender_context->zerocopy_enabled)
+    {
+        sender_context->zerocopy_inflight_count += send_call_count;
+        while (sender_context->zerocopy_inflight_count >= sender_context->client_config->zerocopy_inflight_limit)
+        {
+            if (zerocopy_reap(sender_context->socket_file_descriptor, 1, &sender_context->zerocopy_inflight_count) < 0)
+            {
+                sender_context->zerocopy_inflight_count = 0;
+                break;
+            }
+        }
+        while (zerocopy_reap(sender_context->socket_file_descriptor, 0, &sender_context->zerocopy_inflight_count) > 0)
+        {
+        }
+    }
+    return send_result <= 0 ? -1 : 0;
+}
+
+static void stripe_drain_zerocopy(stripe_sender_context_t *sender_context)
+{
+    while (sender_context->zerocopy_inflight_count > 0)
+    {
+        if (zerocopy_reap(sender_context->socket_file_descriptor, 1, &sender_context->zerocopy_inflight_count) < 0)
+        {
+            sender_context->zerocopy_inflight_count = 0;
+        }
+    }
+}
+
+static void stripe_fill_chunks(stripe_sender_context_t *sender_context)
+{
+    const client_config_t *client_config = sender_context->client_config;
+    size_t chunk_size = client_config->stripe_chunk_size;
+    size_t first_offset = (size_t)sender_context->stripe_index * chunk_size;
+    for (size_t chunk_offset = first_offset; chunk_offset < client_config->message_size; chunk_offset += chunk_size * (size_t)client_config->stripe_connection_count)
+    {
+        size_t chunk_end = client_config->message_size - chunk_offset < chunk_size ? client_config->message_size : chunk_offset + chunk_size;
+        for (size_t byte_offset = chunk_offset; byte_offset < chunk_end; byte_offset++)
+        {
+            sender_context->source_buffer[byte_offset] = (char)stripe_pattern_byte(byte_offset, sender_context->current_message_id);
+        }
+    }
+}
+
+static void *stripe_sender_main(void *thread_argument)
+{
+    stripe_sender_context_t *sender_context = (stripe_sender_context_t *)thread_argument;
+    const client_config_t *client_config = sender_context->client_config;
+    if (client_config->cpu_pin_base >= 0)
+    {
+        pin_thread(client_config->cpu_pin_base + sender_context->stripe_index);
+    }
+    size_t chunk_size = client_config->stripe_chunk_size;
+    int connection_count = client_config->stripe_connection_count;
+    for (;;)
+    {
+        pthread_barrier_wait(sender_context->start_barrier_ptr);
+        stripe_drain_zerocopy(sender_context);
+        if (atomic_load(sender_context->stop_flag_ptr))
+        {
+            break;
+        }
+        if (sender_context->current_message_id % STRIPE_VERIFY_INTERVAL == 0)
+        {
+            stripe_fill_chunks(sender_context);
+        }
+        size_t first_offset = (size_t)sender_context->stripe_index * chunk_size;
+        size_t chunk_index = 0;
+        for (size_t chunk_offset = first_offset; chunk_offset < client_config->message_size; chunk_offset += chunk_size * (size_t)connection_count)
+        {
+            stripe_chunk_header_t *chunk_header_ptr = &sender_context->chunk_header_array[chunk_index++];
+            chunk_header_ptr->message_id = sender_context->current_message_id;
+            chunk_header_ptr->chunk_offset = chunk_offset;
+            chunk_header_ptr->chunk_length = client_config->message_size - chunk_offset < chunk_size ? client_config->message_size - chunk_offset : chunk_size;
+            if (stripe_send_chunk(sender_context, chunk_header_ptr) != 0)
+            {
+                sender_context->send_status = -1;
+                shutdown(sender_context->socket_file_descriptor, SHUT_RDWR);
+                break;
+            }
+        }
+        sender_context->current_message_id++;
+    }
+    return NULL;
+}
+
+int run_stripe_client(const client_config_t *client_config, enum send_mode send_operation_mode)
+{
+    int connection_count = client_config->stripe_connection_count;
+    char *source_buffer = (char *)aligned_alloc(4096, (client_config->message_size + 4095) / 4096 * 4096);
+    pthread_t *sender_thread_array = (pthread_t *)calloc((size_t)connection_count, sizeof(pthread_t));
+    stripe_sender_context_t *sender_context_array = (stripe_sender_context_t *)calloc((size_t)connection_count, sizeof(stripe_sender_context_t));
+    latency_histogram_t *completion_histogram = (latency_histogram_t *)calloc(1, sizeof(latency_histogram_t));
+    if (!source_buffer || !sender_thread_array || !sender_context_array || !completion_histogram)
+    {
+        free(source_buffer);
+        free(sender_thread_array);
+        free(sender_context_array);
+        free(completion_histogram);
+        return 1;
+    }
+    pthread_barrier_t start_barrier;
+    pthread_barrier_init(&start_barrier, NULL, (unsigned int)connection_count + 1);
+    atomic_int stop_flag = 0;
+    for (int stripe_index = 0; stripe_index < connection_count; stripe_index++)
+    {
+        stripe_sender_context_t *sender_context = &sender_context_array[stripe_index];
+        sender_context->stripe_index = stripe_index;
+        sender_context->client_config = client_config;
+        sender_context->send_operation_mode = send_operation_mode;
+        sender_context->source_buffer = source_buffer;
+        sender_context->start_barrier_ptr = &start_barrier;
+        sender_context->stop_flag_ptr = &stop_flag;
+        sender_context->socket_file_descriptor = create_client_socket(client_config->hostname, client_config->port_number);
+        uint32_t stripe_hello = (uint32_t)stripe_index;
+        if (sender_context->socket_file_descriptor < 0 || write_full(sender_context->socket_file_descriptor, &stripe_hello, sizeof(stripe_hello)) <= 0)
+        {
+            perror("stripe connect");
+            return 1;
+        }
+        size_t chunk_count = (client_config->message_size + client_config->stripe_chunk_size - 1) / client_config->stripe_chunk_size;
+        sender_context->chunk_header_array = (stripe_chunk_header_t *)calloc(chunk_count / (size_t)connection_count + 1, sizeof(stripe_chunk_header_t));
+        if (!sender_context->chunk_header_array)
+        {
+            return 1;
+        }
+        if (send_operation_mode == SEND_BASELINE)
+        {
+            sender_context->staging_buffer = (char *)malloc(client_config->stripe_chunk_size);
+            if (!sender_context->staging_buffer)
+            {
+                return 1;
+            }
+        }
+        if (send_operation_mode == SEND_ZEROCOPY)
+        {
+            sender_context->zerocopy_enabled = zerocopy_enable(sender_context->socket_file_descriptor);
+        }
+        pthread_create(&sender_thread_array[stripe_index], NULL, stripe_sender_main, sender_context);
+    }
+
+    int acknowledgement_socket_fd = sender_context_array[0].socket_file_descriptor;
+    uint64_t completed_message_count = 0;
+    uint64_t completion_time_sum_ns = 0;
+    int transfer_status = 0;
+    uint64_t duration_nanoseconds = (uint64_t)client_config->duration_seconds * 1000000000ULL;
+    uint64_t operation_start_time_ns = now_ns();
+    while (now_ns() - operation_start_time_ns < duration_nanoseconds)
+    {
+        uint64_t message_start_time_ns = now_ns();
+        pthread_barrier_wait(&start_barrier);
+        uint64_t acknowledged_message_id;
+        if (read_full(acknowledgement_socket_fd, &acknowledged_message_id, sizeof(acknowledged_message_id)) <= 0 ||
+            acknowledged_message_id != completed_message_count)
+        {
+            transfer_status = -1;
+            break;
+        }
+        uint64_t completion_time_ns = now_ns() - message_start_time_ns;
+        completion_time_sum_ns += completion_time_ns;
+        latency_histogram_record(completion_histogram, completion_time_ns);
+        completed_message_count++;
+    }
+    uint64_t elapsed_nanoseconds = now_ns() - operation_start_time_ns;
+    atomic_store(&stop_flag, 1);
+    if (transfer_status != 0)
+    {
+        for (int stripe_index = 0; stripe_index < connection_count; stripe_index++)
+        {
+            shutdown(sender_context_array[stripe_index].socket_file_descriptor, SHUT_RDWR);
+        }
+    }
+    pthread_barrier_wait(&start_barrier);
+
+    int zerocopy_connection_count = 0;
+    for (int stripe_index = 0; stripe_index < connection_count; stripe_index++)
+    {
+        stripe_sender_context_t *sender_context = &sender_context_array[stripe_index];
+        pthread_join(sender_thread_array[stripe_index], NULL);
+        zerocopy_connection_count += sender_context->zerocopy_enabled;
+        if (sender_context->send_status != 0)
+        {
+            transfer_status = -1;
+        }
+        close(sender_context->socket_file_descriptor);
+        free(sender_context->staging_buffer);
+        free(sender_context->chunk_header_array);
+    }
+    pthread_barrier_destroy(&start_barrier);
+
+    double elapsed_time_seconds = (double)elapsed_nanoseconds / 1e9;
+    uint64_t total_bytes = completed_message_count * client_config->message_size;
+    report_result(MODE_LATENCY, total_bytes, completed_message_count, completion_time_sum_ns, elapsed_nanoseconds);
+    printf("STRIPE,%d,%zu,%zu,%d,%llu,%.6f\n",
+           connection_count,
+           client_config->message_size,
+           client_config->stripe_chunk_size,
+           zerocopy_connection_count == connection_count ? 1 : 0,
+           (unsigned long long)completed_message_count,
+           elapsed_time_seconds > 0.0 ? (double)total_bytes * 8.0 / (elapsed_time_seconds * 1e9) : 0.0);
+    report_latency_percentiles("COMPLETION_PERCENTILES", completion_histogram);
+
+    free(source_buffer);
+    free(sender_thread_array);
+    free(sender_context_array);
+    free(completion_histogram);
+    return transfer_status == 0 ? 0 : 1;
+}
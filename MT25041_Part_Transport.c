@@ -0,0 +1,969 @@
+#include "MT25041_Part_Transport.h"
+
+#include <linux/tls.h>
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+
+#define KTLS_HANDSHAKE_MAGIC 0x4d544c53u
+#define KTLS_HANDSHAKE_VERSION 1u
+
+typedef struct
+{
+    uint32_t handshake_magic;
+    uint32_t handshake_version;
+    uint64_t connection_nonce;
+} ktls_handshake_message_t;
+
+static const unsigned char ktls_test_keys[2][TLS_CIPHER_AES_GCM_128_KEY_SIZE] = {
+    {0x4d, 0x54, 0x32, 0x35, 0x30, 0x34, 0x31, 0x2d, 0x63, 0x32, 0x73, 0x2d, 0x6b, 0x65, 0x79, 0x00},
+    {0x4d, 0x54, 0x32, 0x35, 0x30, 0x34, 0x31, 0x2d, 0x73, 0x32, 0x63, 0x2d, 0x6b, 0x65, 0x79, 0x00}};
+static const unsigned char ktls_test_salts[2][TLS_CIPHER_AES_GCM_128_SALT_SIZE] = {
+    {0x63, 0x32, 0x73, 0x00},
+    {0x73, 0x32, 0x63, 0x00}};
+
+uint64_t now_ns(void)
+{
+    struct timespec timestamp;
+    clock_gettime(CLOCK_MONOTONIC, &timestamp);
+    return (uint64_t)timestamp.tv_sec * 1000000000ULL + (uint64_t)timestamp.tv_nsec;
+}
+
+static int latency_histogram_index(uint64_t value)
+{
+    if (value < LATENCY_HISTOGRAM_SUB_BUCKETS)
+    {
+        return (int)value;
+    }
+    int most_significant_bit = 63 - __builtin_clzll(value);
+    int exponent_group = most_significant_bit - LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1;
+    int mantissa_index = (int)((value >> (most_significant_bit - LATENCY_HISTOGRAM_SUB_BUCKET_BITS)) & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1));
+    return exponent_group * LATENCY_HISTOGRAM_SUB_BUCKETS + mantissa_index;
+}
+
+static uint64_t latency_histogram_value(int bucket_index)
+{
+    int exponent_group = bucket_index / LATENCY_HISTOGRAM_SUB_BUCKETS;
+    uint64_t mantissa_index = (uint64_t)(bucket_index % LATENCY_HISTOGRAM_SUB_BUCKETS);
+    if (exponent_group == 0)
+    {
+        return mantissa_index;
+    }
+    return (LATENCY_HISTOGRAM_SUB_BUCKETS + mantissa_index) << (exponent_group - 1);
+}
+
+void latency_histogram_record(latency_histogram_t *histogram_ptr, uint64_t value)
+{
+    histogram_ptr->bucket_counts[latency_histogram_index(value)]++;
+    histogram_ptr->total_count++;
+    if (value > histogram_ptr->maximum_value)
+    {
+        histogram_ptr->maximum_value = value;
+    }
+}
+
+void latency_histogram_merge(latency_histogram_t *destination_ptr, const latency_histogram_t *source_ptr)
+{
+    for (int bucket_index = 0; bucket_index < LATENCY_HISTOGRAM_BUCKETS; bucket_index++)
+    {
+        destination_ptr->bucket_counts[bucket_index] += source_ptr->bucket_counts[bucket_index];
+    }
+    destination_ptr->total_count += source_ptr->total_count;
+    if (source_ptr->maximum_value > destination_ptr->maximum_value)
+    {
+        destination_ptr->maximum_value = source_ptr->maximum_value;
+    }
+}
+
+uint64_t latency_histogram_percentile(const latency_histogram_t *histogram_ptr, double percentile)
+{
+    if (histogram_ptr->total_count == 0)
+    {
+        return 0;
+    }
+    uint64_t target_rank = (uint64_t)(percentile * (double)histogram_ptr->total_count + 0.999999);
+    if (target_rank < 1)
+    {
+        target_rank = 1;
+    }
+    uint64_t cumulative_count = 0;
+    for (int bucket_index = 0; bucket_index < LATENCY_HISTOGRAM_BUCKETS; bucket_index++)
+    {
+        cumulative_count += histogram_ptr->bucket_counts[bucket_index];
+        if (cumulative_count >= target_rank)
+        {
+            uint64_t bucket_value = latency_histogram_value(bucket_index);
+            return bucket_value < histogram_ptr->maximum_value ? bucket_value : histogram_ptr->maximum_value;
+        }
+    }
+    return histogram_ptr->maximum_value;
+}
+
+void report_latency_percentiles(const char *line_prefix, const latency_histogram_t *histogram_ptr)
+{
+    printf("%s,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+           line_prefix,
+           (double)latency_histogram_percentile(histogram_ptr, 0.50) / 1000.0,
+           (double)latency_histogram_percentile(histogram_ptr, 0.90) / 1000.0,
+           (double)latency_histogram_percentile(histogram_ptr, 0.99) / 1000.0,
+           (double)latency_histogram_percentile(histogram_ptr, 0.999) / 1000.0,
+           (double)histogram_ptr->maximum_value / 1000.0);
+}
+
+int pin_thread(int cpu_core_id)
+{
+    if (cpu_core_id < 0)
+    {
+        return 0;
+    }
+    cpu_set_t cpu_affinity_set;
+    CPU_ZERO(&cpu_affinity_set);
+    CPU_SET(cpu_core_id, &cpu_affinity_set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_affinity_set), &cpu_affinity_set);
+}
+
+static int set_common_sockopts(int socket_file_descriptor)
+{
+    int enable_option = 1;
+    if (setsockopt(socket_file_descriptor, IPPROTO_TCP, TCP_NODELAY, &enable_option, sizeof(enable_option)) != 0)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+int read_full(int socket_file_descriptor, void *buffer, size_t buffer_length)
+{
+    size_t bytes_read_offset = 0;
+    while (bytes_read_offset < buffer_length)
+    {
+        ssize_t receive_result = recv(socket_file_descriptor, (char *)buffer + bytes_read_offset, buffer_length - bytes_read_offset, 0);
+        if (receive_result == 0)
+        {
+            return 0;
+        }
+        if (receive_result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        if (receive_result == 0)
+        {
+            return -1;
+        }
+        bytes_read_offset += (size_t)receive_result;
+    }
+    return 1;
+}
+
+int write_full(int socket_file_descriptor, const void *buffer, size_t buffer_length)
+{
+    size_t bytes_written_offset = 0;
+    while (bytes_written_offset < buffer_length)
+    {
+        ssize_t send_result = send(socket_file_descriptor, (const char *)buffer + bytes_written_offset, buffer_length - bytes_written_offset, MSG_NOSIGNAL);
+        if (send_result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        bytes_written_offset += (size_t)send_result;
+    }
+    return 1;
+}
+
+void message_init(message_t *message_ptr, size_t total_size)
+{
+    size_t base_field_size = total_size / FIELD_COUNT;
+    size_t size_remainder = total_size % FIELD_COUNT;
+    message_ptr->total_message_size = total_size;
+    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    {
+        size_t current_field_size = base_field_size + ((field_index == FIELD_COUNT - 1) ? size_remainder : 0);
+        message_ptr->field_sizes[field_index] = current_field_size;
+        message_ptr->field_buffers[field_index] = (char *)malloc(current_field_size);
+        if (message_ptr->field_buffers[field_index])
+        {
+            memset(message_ptr->field_buffers[field_index], 'a' + field_index, current_field_size);
+        }
+    }
+}
+
+void message_free(message_t *message_ptr)
+{
+    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    {
+        free(message_ptr->field_buffers[field_index]);
+        message_ptr->field_buffers[field_index] = NULL;
+        message_ptr->field_sizes[field_index] = 0;
+    }
+    message_ptr->total_message_size = 0;
+}
+
+void message_pack(const message_t *message_ptr, char *destination_buffer)
+{
+    size_t buffer_offset = 0;
+    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    {
+        memcpy(destination_buffer + buffer_offset, message_ptr->field_buffers[field_index], message_ptr->field_sizes[field_index]);
+        buffer_offset += message_ptr->field_sizes[field_index];
+    }
+}
+
+void message_iov(const message_t *message_ptr, struct iovec *io_vector_array)
+{
+    for (int field_index = 0; field_index < FIELD_COUNT; field_index++)
+    {
+        io_vector_array[field_index].iov_base = message_ptr->field_buffers[field_index];
+        io_vector_array[field_index].iov_len = message_ptr->field_sizes[field_index];
+    }
+}
+
+int sendmsg_full(int socket_file_descriptor, struct iovec *io_vector_array, int iovec_count, int send_flags)
+{
+    int send_call_count = 0;
+    return sendmsg_full_counted(socket_file_descriptor, io_vector_array, iovec_count, send_flags, &send_call_count);
+}
+
+int sendmsg_full_counted(int socket_file_descriptor, struct iovec *io_vector_array, int iovec_count, int send_flags, int *send_call_count_ptr)
+{
+    size_t total_bytes_to_send = 0;
+    for (int vector_index = 0; vector_index < iovec_count; vector_index++)
+    {
+        total_bytes_to_send += io_vector_array[vector_index].iov_len;
+    }
+    size_t bytes_sent_total = 0;
+    while (bytes_sent_total < total_bytes_to_send)
+    {
+        struct msghdr message_header;
+        memset(&message_header, 0, sizeof(message_header));
+        message_header.msg_iov = io_vector_array;
+        message_header.msg_iovlen = iovec_count;
+        ssize_t send_result = sendmsg(socket_file_descriptor, &message_header, send_flags);
+        if (send_result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        (*send_call_count_ptr)++;
+        bytes_sent_total += (size_t)send_result;
+        size_t bytes_remaining = (size_t)send_result;
+        int current_vector_index = 0;
+        while (current_vector_index < iovec_count && bytes_remaining > 0)
+        {
+            if (bytes_remaining >= io_vector_array[current_vector_index].iov_len)
+            {
+                bytes_remaining -= io_vector_array[current_vector_index].iov_len;
+                io_vector_array[current_vector_index].iov_len = 0;
+                current_vector_index++;
+            }
+            else
+            {
+                io_vector_array[current_vector_index].iov_base = (char *)io_vector_array[current_vector_index].iov_base + bytes_remaining;
+                io_vector_array[current_vector_index].iov_len -= bytes_remaining;
+                bytes_remaining = 0;
+            }
+        }
+        while (iovec_count > 0 && io_vector_array[0].iov_len == 0)
+        {
+            io_vector_array++;
+            iovec_count--;
+        }
+    }
+    return 1;
+}
+
+int create_server_socket(const char *bind_ip_address, int port_number, int listen_options)
+{
+    int socket_type = SOCK_STREAM | ((listen_options & LISTEN_OPTION_NONBLOCK) ? SOCK_NONBLOCK : 0);
+    int listen_socket_fd = socket(AF_INET, socket_type, 0);
+    if (listen_socket_fd < 0)
+    {
+        return -1;
+    }
+    int enable_reuse_option = 1;
+    setsockopt(listen_socket_fd, SOL_SOCKET, SO_REUSEADDR, &enable_reuse_option, sizeof(enable_reuse_option));
+    if (listen_options & LISTEN_OPTION_REUSEPORT)
+    {
+        if (setsockopt(listen_socket_fd, SOL_SOCKET, SO_REUSEPORT, &enable_reuse_option, sizeof(enable_reuse_option)) != 0)
+        {
+            close(listen_socket_fd);
+            return -1;
+        }
+    }
+    if (listen_options & LISTEN_OPTION_FASTOPEN)
+    {
+        int fastopen_queue_length = 256;
+        if (setsockopt(listen_socket_fd, IPPROTO_TCP, TCP_FASTOPEN, &fastopen_queue_length, sizeof(fastopen_queue_length)) != 0)
+        {
+            perror("setsockopt(TCP_FASTOPEN)");
+        }
+    }
+    set_common_sockopts(listen_socket_fd);
+
+    struct sockaddr_in server_address;
+    memset(&server_address, 0, sizeof(server_address));
+    server_address.sin_family = AF_INET;
+    server_address.sin_port = htons((uint16_t)port_number);
+    server_address.sin_addr.s_addr = bind_ip_address[0] ? inet_addr(bind_ip_address) : INADDR_ANY;
+
+    if (bind(listen_socket_fd, (struct sockaddr *)&server_address, sizeof(server_address)) != 0)
+    {
+        close(listen_socket_fd);
+        return -1;
+    }
+    if (listen(listen_socket_fd, (listen_options & LISTEN_OPTION_REUSEPORT) ? 1024 : 128) != 0)
+    {
+        close(listen_socket_fd);
+        return -1;
+    }
+    return listen_socket_fd;
+}
+
+int create_client_socket(const char *hostname, int port_number)
+{
+    return create_client_socket_with_options(hostname, port_number, 0);
+}
+
+int create_client_socket_with_options(const char *hostname, int port_number, int connect_options)
+{
+    int client_socket_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (client_socket_fd < 0)
+    {
+        return -1;
+    }
+    set_common_sockopts(client_socket_fd);
+    if (connect_options & CONNECT_OPTION_FASTOPEN)
+    {
+        int enable_fastopen_option = 1;
+        if (setsockopt(client_socket_fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &enable_fastopen_option, sizeof(enable_fastopen_option)) != 0)
+        {
+            close(client_socket_fd);
+            return -1;
+        }
+    }
+
+    struct sockaddr_in server_address;
+    memset(&server_address, 0, sizeof(server_address));
+    server_address.sin_family = AF_INET;
+    server_address.sin_port = htons((uint16_t)port_number);
+    if (inet_pton(AF_INET, hostname, &server_address.sin_addr) != 1)
+    {
+        close(client_socket_fd);
+        return -1;
+    }
+    if (connect(client_socket_fd, (struct sockaddr *)&server_address, sizeof(server_address)) != 0)
+    {
+        close(client_socket_fd);
+        return -1;
+    }
+    return client_socket_fd;
+}
+
+int zerocopy_enable(int socket_file_descriptor)
+{
+#ifdef SO_ZEROCOPY
+    int enable_option = 1;
+    if (setsockopt(socket_file_descriptor, SOL_SOCKET, SO_ZEROCOPY, &enable_option, sizeof(enable_option)) == 0)
+    {
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+int zerocopy_reap(int socket_file_descriptor, int blocking_mode, int *inflight_count_ptr)
+{
+    char control_message_buffer[256];
+    char single_data_byte;
+    struct iovec io_vector;
+    struct msghdr message_header;
+
+    memset(&message_header, 0, sizeof(message_header));
+    io_vector.iov_base = &single_data_byte;
+    io_vector.iov_len = sizeof(single_data_byte);
+    message_header.msg_iov = &io_vector;
+    message_header.msg_iovlen = 1;
+    message_header.msg_control = control_message_buffer;
+    message_header.msg_controllen = sizeof(control_message_buffer);
+
+    int receive_flags = MSG_ERRQUEUE | (blocking_mode ? 0 : MSG_DONTWAIT);
+    ssize_t receive_result = recvmsg(socket_file_descriptor, &message_header, receive_flags);
+    if (receive_result < 0)
+    {
+        if (!blocking_mode && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return 0;
+        }
+        return -1;
+    }
+
+    for (struct cmsghdr *control_msg_ptr = CMSG_FIRSTHDR(&message_header); control_msg_ptr; control_msg_ptr = CMSG_NXTHDR(&message_header, control_msg_ptr))
+    {
+        if (control_msg_ptr->cmsg_level == SOL_IP && control_msg_ptr->cmsg_type == IP_RECVERR)
+        {
+            struct sock_extended_err *socket_error_ptr = (struct sock_extended_err *)CMSG_DATA(control_msg_ptr);
+            if (socket_error_ptr && socket_error_ptr->ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+            {
+                uint32_t completion_range_start = socket_error_ptr->ee_info;
+                uint32_t completion_range_end = socket_error_ptr->ee_data;
+                int completed_operations_count = (int)(completion_range_end - completion_range_start + 1);
+                *inflight_count_ptr -= completed_operations_count;
+                if (*inflight_count_ptr < 0)
+                {
+                    *inflight_count_ptr = 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+static int ktls_install_direction(int socket_file_descriptor, int direction_option, int key_index, uint64_t connection_nonce)
+{
+    struct tls12_crypto_info_aes_gcm_128 crypto_information;
+    memset(&crypto_information, 0, sizeof(crypto_information));
+    crypto_information.info.version = TLS_1_2_VERSION;
+    crypto_information.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+    memcpy(crypto_information.key, ktls_test_keys[key_index], TLS_CIPHER_AES_GCM_128_KEY_SIZE);
+    memcpy(crypto_information.salt, ktls_test_salts[key_index], TLS_CIPHER_AES_GCM_128_SALT_SIZE);
+    memcpy(crypto_information.iv, &connection_nonce, TLS_CIPHER_AES_GCM_128_IV_SIZE);
+    return setsockopt(socket_file_descriptor, SOL_TLS, direction_option, &crypto_information, sizeof(crypto_information));
+}
+
+int ktls_enable(int socket_file_descriptor, int connection_role)
+{
+    ktls_handshake_message_t local_hello;
+    ktls_handshake_message_t peer_hello;
+    local_hello.handshake_magic = KTLS_HANDSHAKE_MAGIC;
+    local_hello.handshake_version = KTLS_HANDSHAKE_VERSION;
+    local_hello.connection_nonce = now_ns() ^ ((uint64_t)getpid() << 32) ^ ((uint64_t)socket_file_descriptor * 0x9e3779b97f4a7c15ULL);
+
+    if (connection_role == KTLS_ROLE_CLIENT)
+    {
+        if (write_full(socket_file_descriptor, &local_hello, sizeof(local_hello)) <= 0 ||
+            read_full(socket_file_descriptor, &peer_hello, sizeof(peer_hello)) <= 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        if (read_full(socket_file_descriptor, &peer_hello, sizeof(peer_hello)) <= 0 ||
+            write_full(socket_file_descriptor, &local_hello, sizeof(local_hello)) <= 0)
+        {
+            return -1;
+        }
+    }
+    if (peer_hello.handshake_magic != KTLS_HANDSHAKE_MAGIC || peer_hello.handshake_version != KTLS_HANDSHAKE_VERSION)
+    {
+        errno = EPROTO;
+        return -1;
+    }
+
+    if (setsockopt(socket_file_descriptor, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) != 0)
+    {
+        return -1;
+    }
+    int transmit_key_index = (connection_role == KTLS_ROLE_CLIENT) ? 0 : 1;
+    if (ktls_install_direction(socket_file_descriptor, TLS_TX, transmit_key_index, local_hello.connection_nonce) != 0 ||
+        ktls_install_direction(socket_file_descriptor, TLS_RX, 1 - transmit_key_index, peer_hello.connection_nonce) != 0)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+const char *transport_send_policy_name(enum transport_send_policy send_policy)
+{
+    switch (send_policy)
+    {
+    case TRANSPORT_SEND_COPY:
+        return "copy";
+    case TRANSPORT_SEND_SENDMSG:
+        return "sendmsg";
+    case TRANSPORT_SEND_ZEROCOPY:
+        return "zerocopy";
+    case TRANSPORT_SEND_SPLICE:
+        return "splice";
+    default:
+        return "unknown";
+    }
+}
+
+const char *transport_receive_policy_name(enum transport_receive_policy receive_policy)
+{
+    switch (receive_policy)
+    {
+    case TRANSPORT_RECEIVE_COPY:
+        return "copy";
+    case TRANSPORT_RECEIVE_SPLICE:
+        return "splice";
+    default:
+        return "unknown";
+    }
+}
+
+static int transport_pipe_create(int *pipe_file_descriptors, size_t requested_capacity)
+{
+    if (pipe2(pipe_file_descriptors, O_CLOEXEC) != 0)
+    {
+        return -1;
+    }
+    if (requested_capacity > 0)
+    {
+        fcntl(pipe_file_descriptors[1], F_SETPIPE_SZ, (int)requested_capacity);
+    }
+    return 0;
+}
+
+static int transport_pipe_drain(int pipe_read_fd, int destination_fd, size_t pipe_bytes)
+{
+    while (pipe_bytes > 0)
+    {
+        ssize_t splice_result = splice(pipe_read_fd, NULL, destination_fd, NULL, pipe_bytes, SPLICE_F_MOVE);
+        if (splice_result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        if (splice_result == 0)
+        {
+            return -1;
+        }
+        pipe_bytes -= (size_t)splice_result;
+    }
+    return 0;
+}
+
+static int transport_splice_full(int socket_file_descriptor, const int *pipe_file_descriptors, struct iovec *io_vector_array, int iovec_count)
+{
+    while (iovec_count > 0)
+    {
+        ssize_t vmsplice_result = vmsplice(pipe_file_descriptors[1], io_vector_array, (unsigned long)iovec_count, 0);
+        if (vmsplice_result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        size_t bytes_remaining = (size_t)vmsplice_result;
+        while (iovec_count > 0 && bytes_remaining >= io_vector_array[0].iov_len)
+        {
+            bytes_remaining -= io_vector_array[0].iov_len;
+            io_vector_array++;
+            iovec_count--;
+        }
+        if (bytes_remaining > 0)
+        {
+            io_vector_array[0].iov_base = (char *)io_vector_array[0].iov_base + bytes_remaining;
+            io_vector_array[0].iov_len -= bytes_remaining;
+        }
+        if (transport_pipe_drain(pipe_file_descriptors[0], socket_file_descriptor, (size_t)vmsplice_result) != 0)
+        {
+            return -1;
+        }
+    }
+    return 1;
+}
+
+static inline __attribute__((always_inline)) int transport_send_loop_body(transport_sender_t *sender_ptr, const enum transport_send_policy send_policy, const int policy_flags)
+{
+    const int echo_enabled = (policy_flags & TRANSPORT_POLICY_ECHO) != 0;
+    const int timing_enabled = (policy_flags & TRANSPORT_POLICY_LATENCY_TIMING) != 0;
+    int batch_size = 1;
+    if (policy_flags & TRANSPORT_POLICY_BATCHING)
+    {
+        batch_size = sender_ptr->batch_size;
+        if (batch_size < 1)
+        {
+            batch_size = 1;
+        }
+        if (batch_size > TRANSPORT_MAXIMUM_BATCH)
+        {
+            batch_size = TRANSPORT_MAXIMUM_BATCH;
+        }
+    }
+    const int socket_file_descriptor = sender_ptr->socket_file_descriptor;
+    const size_t message_size = sender_ptr->message_size;
+    const size_t batch_bytes = message_size * (size_t)batch_size;
+
+    if (send_policy == TRANSPORT_SEND_ZEROCOPY)
+    {
+        sender_ptr->zerocopy_enabled = zerocopy_enable(socket_file_descriptor);
+        if (!sender_ptr->zerocopy_enabled)
+        {
+            return transport_select_send_loop(TRANSPORT_SEND_SENDMSG, policy_flags)(sender_ptr);
+        }
+    }
+
+    int message_buffer_count = 1;
+    if (send_policy == TRANSPORT_SEND_ZEROCOPY && sender_ptr->zerocopy_inflight_limit > 1)
+    {
+        message_buffer_count = sender_ptr->zerocopy_inflight_limit;
+    }
+    message_t *message_buffers_array = (message_t *)calloc((size_t)message_buffer_count, sizeof(message_t));
+    char *send_packed_buffer = (send_policy == TRANSPORT_SEND_COPY) ? (char *)malloc(batch_bytes) : NULL;
+    char *receive_buffer = echo_enabled ? (char *)malloc(batch_bytes) : NULL;
+    struct iovec *io_vector_array = (send_policy != TRANSPORT_SEND_COPY) ? (struct iovec *)calloc((size_t)FIELD_COUNT * (size_t)batch_size, sizeof(struct iovec)) : NULL;
+    int pipe_file_descriptors[2] = {-1, -1};
+    int loop_status = -1;
+    if (!message_buffers_array ||
+        (send_policy == TRANSPORT_SEND_COPY && !send_packed_buffer) ||
+        (echo_enabled && !receive_buffer) ||
+        (send_policy != TRANSPORT_SEND_COPY && !io_vector_array) ||
+        (send_policy == TRANSPORT_SEND_SPLICE && transport_pipe_create(pipe_file_descriptors, batch_bytes) != 0))
+    {
+        free(message_buffers_array);
+        free(send_packed_buffer);
+        free(receive_buffer);
+        free(io_vector_array);
+        return -1;
+    }
+    for (int buffer_index = 0; buffer_index < message_buffer_count; buffer_index++)
+    {
+        message_init(&message_buffers_array[buffer_index], message_size);
+    }
+
+    int send_flags = MSG_NOSIGNAL;
+    int zerocopy_active = 0;
+#ifdef MSG_ZEROCOPY
+    if (send_policy == TRANSPORT_SEND_ZEROCOPY)
+    {
+        send_flags |= MSG_ZEROCOPY;
+        zerocopy_active = 1;
+    }
+#endif
+    int zerocopy_inflight_operations = 0;
+    loop_status = 0;
+
+    uint64_t operation_start_time_ns = now_ns();
+    while (now_ns() - operation_start_time_ns < sender_ptr->duration_nanoseconds)
+    {
+        uint64_t batch_send_start_time_ns = 0;
+        if (timing_enabled)
+        {
+            batch_send_start_time_ns = now_ns();
+        }
+
+        int send_result;
+        if (send_policy == TRANSPORT_SEND_COPY)
+        {
+            for (int batch_index = 0; batch_index < batch_size; batch_index++)
+            {
+                message_pack(&message_buffers_array[0], send_packed_buffer + (size_t)batch_index * message_size);
+            }
+            send_result = write_full(socket_file_descriptor, send_packed_buffer, batch_bytes);
+        }
+        else
+        {
+            for (int batch_index = 0; batch_index < batch_size; batch_index++)
+            {
+                int buffer_index = (int)((sender_ptr->message_count + (uint64_t)batch_index) % (uint64_t)message_buffer_count);
+                message_iov(&message_buffers_array[buffer_index], io_vector_array + (size_t)batch_index * FIELD_COUNT);
+            }
+            if (send_policy == TRANSPORT_SEND_SPLICE)
+            {
+                send_result = transport_splice_full(socket_file_descriptor, pipe_file_descriptors, io_vector_array, FIELD_COUNT * batch_size);
+            }
+            else
+            {
+                int send_call_count = 0;
+                send_result = sendmsg_full_counted(socket_file_descriptor, io_vector_array, FIELD_COUNT * batch_size, send_flags, &send_call_count);
+                if (zerocopy_active)
+                {
+                    zerocopy_inflight_operations += send_call_count;
+                }
+                if (send_result < 0 && zerocopy_active && (errno == EINVAL || errno == EOPNOTSUPP))
+                {
+#ifdef MSG_ZEROCOPY
+                    send_flags &= ~MSG_ZEROCOPY;
+#endif
+                    zerocopy_active = 0;
+                    sender_ptr->zerocopy_enabled = 0;
+                    while (zerocopy_inflight_operations > 0)
+                    {
+                        if (zerocopy_reap(socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
+                        {
+                            break;
+                        }
+                    }
+                    zerocopy_inflight_operations = 0;
+                    send_result = sendmsg_full(socket_file_descriptor, io_vector_array, FIELD_COUNT * batch_size, send_flags);
+                }
+            }
+        }
+        if (send_result <= 0)
+        {
+            loop_status = -1;
+            break;
+        }
+        __atomic_store_n(&sender_ptr->total_bytes_sent, sender_ptr->total_bytes_sent + batch_bytes, __ATOMIC_RELAXED);
+        sender_ptr->message_count += (uint64_t)batch_size;
+
+        if (send_policy == TRANSPORT_SEND_ZEROCOPY && zerocopy_active)
+        {
+            if (zerocopy_inflight_operations >= sender_ptr->zerocopy_inflight_limit)
+            {
+                while (zerocopy_inflight_operations >= sender_ptr->zerocopy_inflight_limit)
+                {
+                    if (zerocopy_reap(socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
+                    {
+                        zerocopy_inflight_operations = 0;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                zerocopy_reap(socket_file_descriptor, 0, &zerocopy_inflight_operations);
+            }
+        }
+
+        if (echo_enabled)
+        {
+            if (read_full(socket_file_descriptor, receive_buffer, batch_bytes) <= 0)
+            {
+                loop_status = -1;
+                break;
+            }
+        }
+
+        if (timing_enabled)
+        {
+            uint64_t batch_round_trip_ns = now_ns() - batch_send_start_time_ns;
+            sender_ptr->round_trip_time_nanoseconds_sum += batch_round_trip_ns * (uint64_t)batch_size;
+            for (int batch_index = 0; batch_index < batch_size; batch_index++)
+            {
+                latency_histogram_record(&sender_ptr->round_trip_histogram, batch_round_trip_ns);
+            }
+        }
+    }
+
+    if (send_policy == TRANSPORT_SEND_ZEROCOPY)
+    {
+        while (zerocopy_inflight_operations > 0)
+        {
+            if (zerocopy_reap(socket_file_descriptor, 1, &zerocopy_inflight_operations) < 0)
+            {
+                break;
+            }
+        }
+    }
+    sender_ptr->elapsed_nanoseconds = now_ns() - operation_start_time_ns;
+
+    if (send_policy == TRANSPORT_SEND_SPLICE)
+    {
+        close(pipe_file_descriptors[0]);
+        close(pipe_file_descriptors[1]);
+    }
+    for (int buffer_index = 0; buffer_index < message_buffer_count; buffer_index++)
+    {
+        message_free(&message_buffers_array[buffer_index]);
+    }
+    free(message_buffers_array);
+    free(send_packed_buffer);
+    free(receive_buffer);
+    free(io_vector_array);
+    return loop_status;
+}
+
+static inline __attribute__((always_inline)) int transport_receive_loop_body(transport_receiver_t *receiver_ptr, const enum transport_receive_policy receive_policy, const int policy_flags)
+{
+    const int echo_enabled = (policy_flags & TRANSPORT_POLICY_ECHO) != 0;
+    const int timing_enabled = (policy_flags & TRANSPORT_POLICY_LATENCY_TIMING) != 0;
+    const int handler_enabled = (policy_flags & TRANSPORT_POLICY_MESSAGE_HANDLER) != 0;
+    const int socket_file_descriptor = receiver_ptr->socket_file_descriptor;
+    const size_t message_size = receiver_ptr->message_size;
+
+    if (receive_policy == TRANSPORT_RECEIVE_SPLICE)
+    {
+        int pipe_file_descriptors[2];
+        if (transport_pipe_create(pipe_file_descriptors, message_size) != 0)
+        {
+            return -1;
+        }
+        int sink_file_descriptor = echo_enabled ? socket_file_descriptor : open("/dev/null", O_WRONLY | O_CLOEXEC);
+        if (sink_file_descriptor < 0)
+        {
+            close(pipe_file_descriptors[0]);
+            close(pipe_file_descriptors[1]);
+            return -1;
+        }
+        size_t pipe_capacity = (size_t)fcntl(pipe_file_descriptors[1], F_GETPIPE_SZ);
+        int loop_status = 0;
+        while (1)
+        {
+            ssize_t splice_result = splice(socket_file_descriptor, NULL, pipe_file_descriptors[1], NULL, pipe_capacity, SPLICE_F_MOVE);
+            if (splice_result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (splice_result <= 0)
+            {
+                loop_status = (splice_result == 0) ? 0 : -1;
+                break;
+            }
+            if (transport_pipe_drain(pipe_file_descriptors[0], sink_file_descriptor, (size_t)splice_result) != 0)
+            {
+                loop_status = -1;
+                break;
+            }
+            __atomic_store_n(&receiver_ptr->total_bytes_received, receiver_ptr->total_bytes_received + (uint64_t)splice_result, __ATOMIC_RELAXED);
+        }
+        receiver_ptr->message_count = receiver_ptr->total_bytes_received / message_size;
+        if (!echo_enabled)
+        {
+            close(sink_file_descriptor);
+        }
+        close(pipe_file_descriptors[0]);
+        close(pipe_file_descriptors[1]);
+        return loop_status;
+    }
+
+    char *receive_buffer = (char *)malloc(message_size);
+    if (!receive_buffer)
+    {
+        return -1;
+    }
+    int loop_status = 0;
+    while (1)
+    {
+        int read_result = read_full(socket_file_descriptor, receive_buffer, message_size);
+        if (read_result <= 0)
+        {
+            loop_status = read_result;
+            break;
+        }
+        uint64_t message_received_time_ns = 0;
+        if (timing_enabled)
+        {
+            message_received_time_ns = now_ns();
+        }
+        if (handler_enabled)
+        {
+            receiver_ptr->message_handler(receiver_ptr->handler_context, receive_buffer, message_size);
+        }
+        if (echo_enabled)
+        {
+            if (write_full(socket_file_descriptor, receive_buffer, message_size) <= 0)
+            {
+                loop_status = -1;
+                break;
+            }
+        }
+        if (timing_enabled)
+        {
+            latency_histogram_record(receiver_ptr->service_histogram_ptr, now_ns() - message_received_time_ns);
+        }
+        __atomic_store_n(&receiver_ptr->total_bytes_received, receiver_ptr->total_bytes_received + message_size, __ATOMIC_RELAXED);
+        receiver_ptr->message_count++;
+    }
+    free(receive_buffer);
+    return loop_status;
+}
+
+#define TRANSPORT_SEND_LOOP_NAME(policy_name, policy_flags) transport_send_loop_##policy_name##_##policy_flags
+
+#define TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, policy_flags)                         \
+    static int TRANSPORT_SEND_LOOP_NAME(policy_name, policy_flags)(transport_sender_t * sender_ptr) \
+    {                                                                                              \
+        return transport_send_loop_body(sender_ptr, send_policy, policy_flags);                   \
+    }
+
+#define TRANSPORT_DEFINE_SEND_LOOPS(policy_name, send_policy) \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 0)   \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 1)   \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 2)   \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 3)   \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 4)   \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 5)   \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 6)   \
+    TRANSPORT_DEFINE_SEND_LOOP(policy_name, send_policy, 7)
+
+#define TRANSPORT_SEND_LOOP_ROW(policy_name)                                                       \
+    {                                                                                              \
+        TRANSPORT_SEND_LOOP_NAME(policy_name, 0), TRANSPORT_SEND_LOOP_NAME(policy_name, 1),       \
+        TRANSPORT_SEND_LOOP_NAME(policy_name, 2), TRANSPORT_SEND_LOOP_NAME(policy_name, 3),       \
+        TRANSPORT_SEND_LOOP_NAME(policy_name, 4), TRANSPORT_SEND_LOOP_NAME(policy_name, 5),       \
+        TRANSPORT_SEND_LOOP_NAME(policy_name, 6), TRANSPORT_SEND_LOOP_NAME(policy_name, 7)        \
+    }
+
+TRANSPORT_DEFINE_SEND_LOOPS(copy, TRANSPORT_SEND_COPY)
+TRANSPORT_DEFINE_SEND_LOOPS(sendmsg, TRANSPORT_SEND_SENDMSG)
+TRANSPORT_DEFINE_SEND_LOOPS(zerocopy, TRANSPORT_SEND_ZEROCOPY)
+TRANSPORT_DEFINE_SEND_LOOPS(splice, TRANSPORT_SEND_SPLICE)
+
+static const transport_send_loop_t transport_send_loop_table[TRANSPORT_SEND_POLICY_COUNT][TRANSPORT_POLICY_MESSAGE_HANDLER] = {
+    [TRANSPORT_SEND_COPY] = TRANSPORT_SEND_LOOP_ROW(copy),
+    [TRANSPORT_SEND_SENDMSG] = TRANSPORT_SEND_LOOP_ROW(sendmsg),
+    [TRANSPORT_SEND_ZEROCOPY] = TRANSPORT_SEND_LOOP_ROW(zerocopy),
+    [TRANSPORT_SEND_SPLICE] = TRANSPORT_SEND_LOOP_ROW(splice),
+};
+
+#define TRANSPORT_RECEIVE_LOOP_NAME(policy_name, policy_flags) transport_receive_loop_##policy_name##_##policy_flags
+
+#define TRANSPORT_DEFINE_RECEIVE_LOOP(policy_name, receive_policy, policy_flags)                             \
+    static int TRANSPORT_RECEIVE_LOOP_NAME(policy_name, policy_flags)(transport_receiver_t * receiver_ptr)   \
+    {                                                                                                        \
+        return transport_receive_loop_body(receiver_ptr, receive_policy, policy_flags);                     \
+    }
+
+TRANSPORT_DEFINE_RECEIVE_LOOP(copy, TRANSPORT_RECEIVE_COPY, 0)
+TRANSPORT_DEFINE_RECEIVE_LOOP(copy, TRANSPORT_RECEIVE_COPY, 1)
+TRANSPORT_DEFINE_RECEIVE_LOOP(copy, TRANSPORT_RECEIVE_COPY, 8)
+TRANSPORT_DEFINE_RECEIVE_LOOP(copy, TRANSPORT_RECEIVE_COPY, 9)
+TRANSPORT_DEFINE_RECEIVE_LOOP(copy, TRANSPORT_RECEIVE_COPY, 12)
+TRANSPORT_DEFINE_RECEIVE_LOOP(copy, TRANSPORT_RECEIVE_COPY, 13)
+TRANSPORT_DEFINE_RECEIVE_LOOP(splice, TRANSPORT_RECEIVE_SPLICE, 0)
+TRANSPORT_DEFINE_RECEIVE_LOOP(splice, TRANSPORT_RECEIVE_SPLICE, 1)
+
+static const transport_receive_loop_t transport_receive_loop_table[TRANSPORT_RECEIVE_POLICY_COUNT][TRANSPORT_POLICY_FLAG_COMBINATIONS] = {
+    [TRANSPORT_RECEIVE_COPY] = {
+        [0] = TRANSPORT_RECEIVE_LOOP_NAME(copy, 0),
+        [TRANSPORT_POLICY_ECHO] = TRANSPORT_RECEIVE_LOOP_NAME(copy, 1),
+        [TRANSPORT_POLICY_MESSAGE_HANDLER] = TRANSPORT_RECEIVE_LOOP_NAME(copy, 8),
+        [TRANSPORT_POLICY_MESSAGE_HANDLER | TRANSPORT_POLICY_ECHO] = TRANSPORT_RECEIVE_LOOP_NAME(copy, 9),
+        [TRANSPORT_POLICY_MESSAGE_HANDLER | TRANSPORT_POLICY_LATENCY_TIMING] = TRANSPORT_RECEIVE_LOOP_NAME(copy, 12),
+        [TRANSPORT_POLICY_MESSAGE_HANDLER | TRANSPORT_POLICY_LATENCY_TIMING | TRANSPORT_POLICY_ECHO] = TRANSPORT_RECEIVE_LOOP_NAME(copy, 13),
+    },
+    [TRANSPORT_RECEIVE_SPLICE] = {
+        [0] = TRANSPORT_RECEIVE_LOOP_NAME(splice, 0),
+        [TRANSPORT_POLICY_ECHO] = TRANSPORT_RECEIVE_LOOP_NAME(splice, 1),
+    },
+};
+
+transport_send_loop_t transport_select_send_loop(enum transport_send_policy send_policy, int policy_flags)
+{
+    if ((int)send_policy < 0 || send_policy >= TRANSPORT_SEND_POLICY_COUNT ||
+        policy_flags < 0 || policy_flags >= TRANSPORT_POLICY_MESSAGE_HANDLER)
+    {
+        return NULL;
+    }
+    return transport_send_loop_table[send_policy][policy_flags];
+}
+
+transport_receive_loop_t transport_select_receive_loop(enum transport_receive_policy receive_policy, int policy_flags)
+{
+    if ((int)receive_policy < 0 || receive_policy >= TRANSPORT_RECEIVE_POLICY_COUNT ||
+        policy_flags < 0 || policy_flags >= TRANSPORT_POLICY_FLAG_COMBINATIONS)
+    {
+        return NULL;
+    }
+    return transport_receive_loop_table[receive_policy][policy_flags];
+}
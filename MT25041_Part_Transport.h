@@ -0,0 +1,138 @@
+#ifndef MT25041_PART_TRANSPORT_H
+#define MT25041_PART_TRANSPORT_H
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/errqueue.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define FIELD_COUNT 8
+#define LISTEN_OPTION_REUSEPORT 0x1
+#define LISTEN_OPTION_FASTOPEN 0x2
+#define LISTEN_OPTION_NONBLOCK 0x4
+#define CONNECT_OPTION_FASTOPEN 0x1
+#define KTLS_ROLE_CLIENT 0
+#define KTLS_ROLE_SERVER 1
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS 5
+#define LATENCY_HISTOGRAM_SUB_BUCKETS (1 << LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+#define LATENCY_HISTOGRAM_BUCKETS ((64 - LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1) * LATENCY_HISTOGRAM_SUB_BUCKETS)
+
+#define TRANSPORT_POLICY_ECHO 0x1
+#define TRANSPORT_POLICY_BATCHING 0x2
+#define TRANSPORT_POLICY_LATENCY_TIMING 0x4
+#define TRANSPORT_POLICY_MESSAGE_HANDLER 0x8
+#define TRANSPORT_POLICY_FLAG_COMBINATIONS 16
+#define TRANSPORT_MAXIMUM_BATCH 128
+
+enum transport_send_policy
+{
+    TRANSPORT_SEND_COPY = 0,
+    TRANSPORT_SEND_SENDMSG = 1,
+    TRANSPORT_SEND_ZEROCOPY = 2,
+    TRANSPORT_SEND_SPLICE = 3,
+    TRANSPORT_SEND_POLICY_COUNT = 4
+};
+
+enum transport_receive_policy
+{
+    TRANSPORT_RECEIVE_COPY = 0,
+    TRANSPORT_RECEIVE_SPLICE = 1,
+    TRANSPORT_RECEIVE_POLICY_COUNT = 2
+};
+
+typedef struct
+{
+    char *field_buffers[FIELD_COUNT];
+    size_t field_sizes[FIELD_COUNT];
+    size_t total_message_size;
+} message_t;
+
+typedef struct
+{
+    uint64_t bucket_counts[LATENCY_HISTOGRAM_BUCKETS];
+    uint64_t total_count;
+    uint64_t maximum_value;
+} latency_histogram_t;
+
+typedef struct
+{
+    int socket_file_descriptor;
+    size_t message_size;
+    int batch_size;
+    int zerocopy_inflight_limit;
+    uint64_t duration_nanoseconds;
+    int zerocopy_enabled;
+    uint64_t total_bytes_sent;
+    uint64_t message_count;
+    uint64_t round_trip_time_nanoseconds_sum;
+    uint64_t elapsed_nanoseconds;
+    latency_histogram_t round_trip_histogram;
+} transport_sender_t;
+
+typedef void (*transport_message_handler_t)(void *handler_context, char *payload_buffer, size_t payload_length);
+
+typedef struct
+{
+    int socket_file_descriptor;
+    size_t message_size;
+    transport_message_handler_t message_handler;
+    void *handler_context;
+    latency_histogram_t *service_histogram_ptr;
+    uint64_t total_bytes_received;
+    uint64_t message_count;
+} transport_receiver_t;
+
+typedef int (*transport_send_loop_t)(transport_sender_t *sender_ptr);
+typedef int (*transport_receive_loop_t)(transport_receiver_t *receiver_ptr);
+
+uint64_t now_ns(void);
+int pin_thread(int cpu_core_id);
+int read_full(int socket_file_descriptor, void *buffer, size_t buffer_length);
+int write_full(int socket_file_descriptor, const void *buffer, size_t buffer_length);
+void message_init(message_t *message_ptr, size_t total_size);
+void message_free(message_t *message_ptr);
+void message_pack(const message_t *message_ptr, char *destination_buffer);
+void message_iov(const message_t *message_ptr, struct iovec *io_vector_array);
+int sendmsg_full(int socket_file_descriptor, struct iovec *io_vector_array, int iovec_count, int send_flags);
+int sendmsg_full_counted(int socket_file_descriptor, struct iovec *io_vector_array, int iovec_count, int send_flags, int *send_call_count_ptr);
+int create_client_socket(const char *hostname, int port_number);
+int create_client_socket_with_options(const char *hostname, int port_number, int connect_options);
+int create_server_socket(const char *bind_ip_address, int port_number, int listen_options);
+int zerocopy_enable(int socket_file_descriptor);
+int zerocopy_reap(int socket_file_descriptor, int blocking_mode, int *inflight_count_ptr);
+int ktls_enable(int socket_file_descriptor, int connection_role);
+
+void latency_histogram_record(latency_histogram_t *histogram_ptr, uint64_t value);
+void latency_histogram_merge(latency_histogram_t *destination_ptr, const latency_histogram_t *source_ptr);
+uint64_t latency_histogram_percentile(const latency_histogram_t *histogram_ptr, double percentile);
+void report_latency_percentiles(const char *line_prefix, const latency_histogram_t *histogram_ptr);
+
+const char *transport_send_policy_name(enum transport_send_policy send_policy);
+const char *transport_receive_policy_name(enum transport_receive_policy receive_policy);
+transport_send_loop_t transport_select_send_loop(enum transport_send_policy send_policy, int policy_flags);
+transport_receive_loop_t transport_select_receive_loop(enum transport_receive_policy receive_policy, int policy_flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
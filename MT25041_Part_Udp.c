@@ -0,0 +1,597 @@
+#include "MT25041_Part_Common.h"
+
+#include <netinet/udp.h>
+#include <poll.h>
+#include <stdatomic.h>
+
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+#define UDP_HEADER_BYTES 16
+#define UDP_MAXIMUM_PAYLOAD 65507
+#define UDP_MAXIMUM_SEGMENTS 64
+#define UDP_RECEIVE_BATCH 64
+#define UDP_RECEIVE_BUFFER_BYTES 65536
+#define UDP_SOCKET_BUFFER_BYTES (8 * 1024 * 1024)
+#define UDP_MAXIMUM_FLOWS 64
+#define UDP_END_MARKER UINT64_MAX
+#define UDP_POLL_TIMEOUT_MILLISECONDS 100
+#define UDP_REPORT_ATTEMPTS 25
+
+typedef struct
+{
+    struct sockaddr_in peer_address;
+    uint64_t received_count;
+    uint64_t reordered_count;
+    uint64_t next_expected_sequence;
+    int finished;
+} udp_flow_t;
+
+typedef struct
+{
+    int thread_index;
+    int socket_file_descriptor;
+    const server_config_t *server_config;
+    atomic_int *finished_flow_count_ptr;
+    atomic_int *stop_flag_ptr;
+    int gro_enabled;
+    uint64_t received_datagram_count;
+    uint64_t received_byte_count;
+    uint64_t receive_syscall_count;
+    udp_flow_t flow_array[UDP_MAXIMUM_FLOWS];
+    int flow_count;
+} udp_server_thread_context_t;
+
+typedef struct
+{
+    int thread_index;
+    const client_config_t *client_config;
+    enum send_mode send_operation_mode;
+    int gso_segments;
+    int zerocopy_enabled;
+    int zerocopy_pending_count;
+    int report_received;
+    uint64_t sent_datagram_count;
+    uint64_t send_syscall_count;
+    uint64_t received_count;
+    uint64_t reordered_count;
+    uint64_t elapsed_nanoseconds;
+} udp_client_thread_context_t;
+
+static void udp_enlarge_socket_buffer(int socket_file_descriptor, int buffer_option, int forced_buffer_option)
+{
+    int buffer_bytes = UDP_SOCKET_BUFFER_BYTES;
+    if (setsockopt(socket_file_descriptor, SOL_SOCKET, forced_buffer_option, &buffer_bytes, sizeof(buffer_bytes)) != 0)
+    {
+        setsockopt(socket_file_descriptor, SOL_SOCKET, buffer_option, &buffer_bytes, sizeof(buffer_bytes));
+    }
+}
+
+static int udp_create_server_socket(const server_config_t *server_config, int reuseport_enabled)
+{
+    int socket_file_descriptor = socket(AF_INET, SOCK_DGRAM, 0);
+    if (socket_file_descriptor < 0)
+    {
+        return -1;
+    }
+    int enable_option = 1;
+    setsockopt(socket_file_descriptor, SOL_SOCKET, SO_REUSEADDR, &enable_option, sizeof(enable_option));
+    if (reuseport_enabled)
+    {
+        setsockopt(socket_file_descriptor, SOL_SOCKET, SO_REUSEPORT, &enable_option, sizeof(enable_option));
+    }
+    udp_enlarge_socket_buffer(socket_file_descriptor, SO_RCVBUF, SO_RCVBUFFORCE);
+    struct timeval receive_timeout = {0, UDP_POLL_TIMEOUT_MILLISECONDS * 1000};
+    setsockopt(socket_file_descriptor, SOL_SOCKET, SO_RCVTIMEO, &receive_timeout, sizeof(receive_timeout));
+
+    struct sockaddr_in server_address;
+    memset(&server_address, 0, sizeof(server_address));
+    server_address.sin_family = AF_INET;
+    server_address.sin_port = htons((uint16_t)server_config->port_number);
+    server_address.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (server_config->bind_ip_address[0] && inet_pton(AF_INET, server_config->bind_ip_address, &server_address.sin_addr) != 1)
+    {
+        close(socket_file_descriptor);
+        return -1;
+    }
+    if (bind(socket_file_descriptor, (struct sockaddr *)&server_address, sizeof(server_address)) != 0)
+    {
+        close(socket_file_descriptor);
+        return -1;
+    }
+    return socket_file_descriptor;
+}
+
+static udp_flow_t *udp_find_flow(udp_server_thread_context_t *thread_context, const struct sockaddr_in *peer_address_ptr)
+{
+    for (int flow_index = 0; flow_index < thread_context->flow_count; flow_index++)
+    {
+        udp_flow_t *flow_ptr = &thread_context->flow_array[flow_index];
+        if (flow_ptr->peer_address.sin_port == peer_address_ptr->sin_port &&
+            flow_ptr->peer_address.sin_addr.s_addr == peer_address_ptr->sin_addr.s_addr)
+        {
+            return flow_ptr;
+        }
+    }
+    if (thread_context->flow_count >= UDP_MAXIMUM_FLOWS)
+    {
+        return NULL;
+    }
+    udp_flow_t *flow_ptr = &thread_context->flow_array[thread_context->flow_count++];
+    memset(flow_ptr, 0, sizeof(*flow_ptr));
+    flow_ptr->peer_address = *peer_address_ptr;
+    return flow_ptr;
+}
+
+static void udp_handle_end_marker(udp_server_thread_context_t *thread_context, udp_flow_t *flow_ptr)
+{
+    uint64_t report_words[4] = {UDP_END_MARKER, flow_ptr->received_count, flow_ptr->reordered_count, flow_ptr->next_expected_sequence};
+    sendto(thread_context->socket_file_descriptor, report_words, sizeof(report_words), 0,
+           (const struct sockaddr *)&flow_ptr->peer_address, sizeof(flow_ptr->peer_address));
+    if (!flow_ptr->finished)
+    {
+        flow_ptr->finished = 1;
+        atomic_fetch_add(thread_context->finished_flow_count_ptr, 1);
+    }
+}
+
+static void udp_handle_segment(udp_server_thread_context_t *thread_context, udp_flow_t *flow_ptr, const char *segment_buffer, size_t segment_length)
+{
+    if (segment_length < UDP_HEADER_BYTES)
+    {
+        return;
+    }
+    uint64_t sequence_number;
+    memcpy(&sequence_number, segment_buffer, sizeof(sequence_number));
+    if (sequence_number == UDP_END_MARKER)
+    {
+        udp_handle_end_marker(thread_context, flow_ptr);
+        return;
+    }
+    thread_context->received_datagram_count++;
+    thread_context->received_byte_count += segment_length;
+    flow_ptr->received_count++;
+    if (sequence_number < flow_ptr->next_expected_sequence)
+    {
+        flow_ptr->reordered_count++;
+    }
+    else
+    {
+        flow_ptr->next_expected_sequence = sequence_number + 1;
+    }
+}
+
+static void *udp_server_thread_main(void *thread_argument)
+{
+    udp_server_thread_context_t *thread_context = (udp_server_thread_context_t *)thread_argument;
+    const server_config_t *server_config = thread_context->server_config;
+    if (server_config->cpu_pin_base >= 0)
+    {
+        pin_thread(server_config->cpu_pin_base + thread_context->thread_index);
+    }
+
+    char *receive_buffer_area = (char *)malloc((size_t)UDP_RECEIVE_BATCH * UDP_RECEIVE_BUFFER_BYTES);
+    struct mmsghdr *message_vector = (struct mmsghdr *)calloc(UDP_RECEIVE_BATCH, sizeof(struct mmsghdr));
+    struct iovec *io_vector_array = (struct iovec *)calloc(UDP_RECEIVE_BATCH, sizeof(struct iovec));
+    struct sockaddr_in *peer_address_array = (struct sockaddr_in *)calloc(UDP_RECEIVE_BATCH, sizeof(struct sockaddr_in));
+    char *control_buffer_area = (char *)calloc(UDP_RECEIVE_BATCH, CMSG_SPACE(sizeof(int)));
+    if (!receive_buffer_area || !message_vector || !io_vector_array || !peer_address_array || !control_buffer_area)
+    {
+        free(receive_buffer_area);
+        free(message_vector);
+        free(io_vector_array);
+        free(peer_address_array);
+        free(control_buffer_area);
+        return NULL;
+    }
+
+    uint64_t stop_deadline_ns = server_config->duration_seconds > 0 ? now_ns() + (uint64_t)server_config->duration_seconds * 1000000000ULL : 0;
+    while (!atomic_load(thread_context->stop_flag_ptr))
+    {
+        for (int entry_index = 0; entry_index < UDP_RECEIVE_BATCH; entry_index++)
+        {
+            io_vector_array[entry_index].iov_base = receive_buffer_area + (size_t)entry_index * UDP_RECEIVE_BUFFER_BYTES;
+            io_vector_array[entry_index].iov_len = UDP_RECEIVE_BUFFER_BYTES;
+            memset(&message_vector[entry_index].msg_hdr, 0, sizeof(struct msghdr));
+            message_vector[entry_index].msg_hdr.msg_iov = &io_vector_array[entry_index];
+            message_vector[entry_index].msg_hdr.msg_iovlen = 1;
+            message_vector[entry_index].msg_hdr.msg_name = &peer_address_array[entry_index];
+            message_vector[entry_index].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+            message_vector[entry_index].msg_hdr.msg_control = control_buffer_area + (size_t)entry_index * CMSG_SPACE(sizeof(int));
+            message_vector[entry_index].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(int));
+        }
+
+        int received_entry_count = recvmmsg(thread_context->socket_file_descriptor, message_vector, UDP_RECEIVE_BATCH, MSG_WAITFORONE, NULL);
+        if (received_entry_count < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                break;
+            }
+            if (atomic_load(thread_context->finished_flow_count_ptr) >= server_config->maximum_clients ||
+                (stop_deadline_ns && now_ns() >= stop_deadline_ns))
+            {
+                atomic_store(thread_context->stop_flag_ptr, 1);
+            }
+            continue;
+        }
+        thread_context->receive_syscall_count++;
+
+        for (int entry_index = 0; entry_index < received_entry_count; entry_index++)
+        {
+            struct msghdr *message_header_ptr = &message_vector[entry_index].msg_hdr;
+            size_t datagram_length = message_vector[entry_index].msg_len;
+            size_t segment_size = datagram_length;
+            for (struct cmsghdr *control_msg_ptr = CMSG_FIRSTHDR(message_header_ptr); control_msg_ptr; control_msg_ptr = CMSG_NXTHDR(message_header_ptr, control_msg_ptr))
+            {
+                if (control_msg_ptr->cmsg_level == SOL_UDP && control_msg_ptr->cmsg_type == UDP_GRO)
+                {
+                    int gro_segment_size;
+                    memcpy(&gro_segment_size, CMSG_DATA(control_msg_ptr), sizeof(gro_segment_size));
+                    if (gro_segment_size > 0)
+                    {
+                        segment_size = (size_t)gro_segment_size;
+                    }
+                }
+            }
+            udp_flow_t *flow_ptr = udp_find_flow(thread_context, &peer_address_array[entry_index]);
+            if (!flow_ptr || segment_size == 0)
+            {
+                continue;
+            }
+            const char *datagram_buffer = (const char *)io_vector_array[entry_index].iov_base;
+            for (size_t segment_offset = 0; segment_offset < datagram_length; segment_offset += segment_size)
+            {
+                size_t segment_length = datagram_length - segment_offset < segment_size ? datagram_length - segment_offset : segment_size;
+                udp_handle_segment(thread_context, flow_ptr, datagram_buffer + segment_offset, segment_length);
+            }
+        }
+    }
+
+    free(receive_buffer_area);
+    free(message_vector);
+    free(io_vector_array);
+    free(peer_address_array);
+    free(control_buffer_area);
+    return NULL;
+}
+
+int run_udp_server(const server_config_t *server_config)
+{
+    int socket_count = server_config->maximum_clients > 0 ? server_config->maximum_clients : 1;
+    pthread_t *server_thread_array = (pthread_t *)calloc((size_t)socket_count, sizeof(pthread_t));
+    udp_server_thread_context_t *thread_context_array = (udp_server_thread_context_t *)calloc((size_t)socket_count, sizeof(udp_server_thread_context_t));
+    if (!server_thread_array || !thread_context_array)
+    {
+        free(server_thread_array);
+        free(thread_context_array);
+        return 1;
+    }
+
+    atomic_int finished_flow_count = 0;
+    atomic_int stop_flag = 0;
+    int gro_enabled = 1;
+    for (int thread_index = 0; thread_index < socket_count; thread_index++)
+    {
+        udp_server_thread_context_t *thread_context = &thread_context_array[thread_index];
+        thread_context->socket_file_descriptor = udp_create_server_socket(server_config, socket_count > 1);
+        if (thread_context->socket_file_descriptor < 0)
+        {
+            perror("udp socket");
+            for (int opened_index = 0; opened_index < thread_index; opened_index++)
+            {
+                close(thread_context_array[opened_index].socket_file_descriptor);
+            }
+            free(server_thread_array);
+            free(thread_context_array);
+            return 1;
+        }
+        int enable_option = 1;
+        if (setsockopt(thread_context->socket_file_descriptor, SOL_UDP, UDP_GRO, &enable_option, sizeof(enable_option)) != 0)
+        {
+            gro_enabled = 0;
+        }
+        thread_context->thread_index = thread_index;
+        thread_context->server_config = server_config;
+        thread_context->finished_flow_count_ptr = &finished_flow_count;
+        thread_context->stop_flag_ptr = &stop_flag;
+    }
+
+    uint64_t start_time_ns = now_ns();
+    for (int thread_index = 0; thread_index < socket_count; thread_index++)
+    {
+        pthread_create(&server_thread_array[thread_index], NULL, udp_server_thread_main, &thread_context_array[thread_index]);
+    }
+
+    uint64_t received_datagram_count = 0;
+    uint64_t received_byte_count = 0;
+    uint64_t receive_syscall_count = 0;
+    for (int thread_index = 0; thread_index < socket_count; thread_index++)
+    {
+        pthread_join(server_thread_array[thread_index], NULL);
+        received_datagram_count += thread_context_array[thread_index].received_datagram_count;
+        received_byte_count += thread_context_array[thread_index].received_byte_count;
+        receive_syscall_count += thread_context_array[thread_index].receive_syscall_count;
+        close(thread_context_array[thread_index].socket_file_descriptor);
+    }
+    double elapsed_time_seconds = (double)(now_ns() - start_time_ns) / 1e9;
+
+    printf("SERVER_UDP,%d,%d,%llu,%llu,%.2f,%.6f\n",
+           socket_count,
+           gro_enabled,
+           (unsigned long long)received_datagram_count,
+           (unsigned long long)receive_syscall_count,
+           receive_syscall_count ? (double)received_datagram_count / (double)receive_syscall_count : 0.0,
+           elapsed_time_seconds > 0.0 ? (double)received_byte_count * 8.0 / (elapsed_time_seconds * 1e9) : 0.0);
+    free(server_thread_array);
+    free(thread_context_array);
+    return 0;
+}
+
+static int udp_reap_until(int socket_file_descriptor, int *inflight_count_ptr, int inflight_target, uint64_t deadline_ns)
+{
+    while (*inflight_count_ptr > inflight_target && now_ns() < deadline_ns)
+    {
+        struct pollfd error_poll = {socket_file_descriptor, 0, 0};
+        poll(&error_poll, 1, 1);
+        while (zerocopy_reap(socket_file_descriptor, 0, inflight_count_ptr) > 0)
+        {
+        }
+    }
+    return *inflight_count_ptr > inflight_target ? -1 : 0;
+}
+
+static int udp_exchange_report(udp_client_thread_context_t *thread_context, int socket_file_descriptor)
+{
+    struct timeval receive_timeout = {0, UDP_POLL_TIMEOUT_MILLISECONDS * 2000};
+    setsockopt(socket_file_descriptor, SOL_SOCKET, SO_RCVTIMEO, &receive_timeout, sizeof(receive_timeout));
+    uint64_t marker_words[2] = {UDP_END_MARKER, thread_context->sent_datagram_count};
+    for (int attempt_index = 0; attempt_index < UDP_REPORT_ATTEMPTS; attempt_index++)
+    {
+        if (send(socket_file_descriptor, marker_words, sizeof(marker_words), 0) < 0 && errno != ENOBUFS && errno != ECONNREFUSED)
+        {
+            return -1;
+        }
+        uint64_t report_words[4];
+        ssize_t receive_result = recv(socket_file_descriptor, report_words, sizeof(report_words), 0);
+        if (receive_result == (ssize_t)sizeof(report_words) && report_words[0] == UDP_END_MARKER)
+        {
+            thread_context->received_count = report_words[1];
+            thread_context->reordered_count = report_words[2];
+            thread_context->report_received = 1;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static void *udp_client_thread_main(void *thread_argument)
+{
+    udp_client_thread_context_t *thread_context = (udp_client_thread_context_t *)thread_argument;
+    const client_config_t *client_config = thread_context->client_config;
+    if (client_config->cpu_pin_base >= 0)
+    {
+        pin_thread(client_config->cpu_pin_base + thread_context->thread_index);
+    }
+
+    int socket_file_descriptor = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in server_address;
+    memset(&server_address, 0, sizeof(server_address));
+    server_address.sin_family = AF_INET;
+    server_address.sin_port = htons((uint16_t)client_config->port_number);
+    if (socket_file_descriptor < 0 || inet_pton(AF_INET, client_config->hostname, &server_address.sin_addr) != 1 ||
+        connect(socket_file_descriptor, (struct sockaddr *)&server_address, sizeof(server_address)) != 0)
+    {
+        perror("udp connect");
+        if (socket_file_descriptor >= 0)
+        {
+            close(socket_file_descriptor);
+        }
+        return NULL;
+    }
+    udp_enlarge_socket_buffer(socket_file_descriptor, SO_SNDBUF, SO_SNDBUFFORCE);
+    if (thread_context->gso_segments > 1)
+    {
+        int segment_size_option = (int)client_config->message_size;
+        if (setsockopt(socket_file_descriptor, SOL_UDP, UDP_SEGMENT, &segment_size_option, sizeof(segment_size_option)) != 0)
+        {
+            thread_context->gso_segments = 1;
+        }
+    }
+    if (thread_context->send_operation_mode == SEND_ZEROCOPY)
+    {
+        thread_context->zerocopy_enabled = zerocopy_enable(socket_file_descriptor);
+    }
+
+    size_t message_size = client_config->message_size;
+    int batch_size = client_config->send_batch_size;
+    size_t entry_bytes = message_size * (size_t)thread_context->gso_segments;
+    int slot_count = thread_context->zerocopy_enabled ? client_config->zerocopy_inflight_limit : 1;
+    if (slot_count < 1)
+    {
+        slot_count = 1;
+    }
+    char *payload_area = (char *)malloc(entry_bytes * (size_t)batch_size * (size_t)slot_count);
+    struct mmsghdr *message_vector = (struct mmsghdr *)calloc((size_t)batch_size, sizeof(struct mmsghdr));
+    struct iovec *io_vector_array = (struct iovec *)calloc((size_t)batch_size, sizeof(struct iovec));
+    message_t source_message;
+    message_init(&source_message, message_size);
+    if (!payload_area || !message_vector || !io_vector_array)
+    {
+        free(payload_area);
+        free(message_vector);
+        free(io_vector_array);
+        message_free(&source_message);
+        close(socket_file_descriptor);
+        return NULL;
+    }
+    size_t datagram_count_per_slot = (size_t)batch_size * (size_t)thread_context->gso_segments;
+    for (size_t datagram_index = 0; datagram_index < datagram_count_per_slot * (size_t)slot_count; datagram_index++)
+    {
+        message_pack(&source_message, payload_area + datagram_index * message_size);
+    }
+
+    int send_flags = 0;
+#ifdef MSG_ZEROCOPY
+    if (thread_context->zerocopy_enabled)
+    {
+        send_flags |= MSG_ZEROCOPY;
+    }
+#endif
+    int zerocopy_inflight_operations = 0;
+    int inflight_target = (slot_count - 1) * batch_size;
+    uint64_t next_sequence_number = 0;
+    uint64_t slot_index = 0;
+    uint64_t duration_nanoseconds = (uint64_t)client_config->duration_seconds * 1000000000ULL;
+    uint64_t operation_start_time_ns = now_ns();
+    while (now_ns() - operation_start_time_ns < duration_nanoseconds)
+    {
+        char *slot_buffer = payload_area + (size_t)(slot_index % (uint64_t)slot_count) * entry_bytes * (size_t)batch_size;
+        if (thread_context->zerocopy_enabled && zerocopy_inflight_operations > inflight_target &&
+            udp_reap_until(socket_file_descriptor, &zerocopy_inflight_operations, inflight_target, operation_start_time_ns + duration_nanoseconds) != 0)
+        {
+            break;
+        }
+        for (size_t datagram_index = 0; datagram_index < datagram_count_per_slot; datagram_index++)
+        {
+            char *datagram_buffer = slot_buffer + datagram_index * message_size;
+            if (thread_context->send_operation_mode == SEND_BASELINE)
+            {
+                message_pack(&source_message, datagram_buffer);
+            }
+            uint64_t sequence_number = next_sequence_number + datagram_index;
+            memcpy(datagram_buffer, &sequence_number, sizeof(sequence_number));
+        }
+        for (int entry_index = 0; entry_index < batch_size; entry_index++)
+        {
+            io_vector_array[entry_index].iov_base = slot_buffer + (size_t)entry_index * entry_bytes;
+            io_vector_array[entry_index].iov_len = entry_bytes;
+            memset(&message_vector[entry_index].msg_hdr, 0, sizeof(struct msghdr));
+            message_vector[entry_index].msg_hdr.msg_iov = &io_vector_array[entry_index];
+            message_vector[entry_index].msg_hdr.msg_iovlen = 1;
+        }
+
+        int sent_entry_count = sendmmsg(socket_file_descriptor, message_vector, (unsigned int)batch_size, send_flags);
+        if (sent_entry_count < 0)
+        {
+            if (errno == ENOBUFS || errno == EAGAIN || errno == EINTR || errno == ECONNREFUSED)
+            {
+                continue;
+            }
+            perror("sendmmsg");
+            break;
+        }
+        thread_context->send_syscall_count++;
+        thread_context->sent_datagram_count += (uint64_t)sent_entry_count * (uint64_t)thread_context->gso_segments;
+        next_sequence_number += (uint64_t)sent_entry_count * (uint64_t)thread_context->gso_segments;
+        if (thread_context->zerocopy_enabled)
+        {
+            zerocopy_inflight_operations += sent_entry_count;
+            zerocopy_reap(socket_file_descriptor, 0, &zerocopy_inflight_operations);
+        }
+        slot_index++;
+    }
+    thread_context->elapsed_nanoseconds = now_ns() - operation_start_time_ns;
+    if (thread_context->zerocopy_enabled &&
+        udp_reap_until(socket_file_descriptor, &zerocopy_inflight_operations, 0, now_ns() + 1000000000ULL) != 0)
+    {
+        fprintf(stderr, "udp thread %d: %d zerocopy completions still pending\n", thread_context->thread_index, zerocopy_inflight_operations);
+        thread_context->zerocopy_pending_count = zerocopy_inflight_operations;
+    }
+
+    if (udp_exchange_report(thread_context, socket_file_descriptor) != 0)
+    {
+        fprintf(stderr, "udp thread %d: no report from server\n", thread_context->thread_index);
+    }
+
+    free(payload_area);
+    free(message_vector);
+    free(io_vector_array);
+    message_free(&source_message);
+    close(socket_file_descriptor);
+    return NULL;
+}
+
+int run_udp_client(const client_config_t *client_config, enum send_mode send_operation_mode)
+{
+    int gso_segments = client_config->udp_gso_segments > 1 ? client_config->udp_gso_segments : 1;
+    if (gso_segments > UDP_MAXIMUM_SEGMENTS)
+    {
+        gso_segments = UDP_MAXIMUM_SEGMENTS;
+    }
+    while (gso_segments > 1 && client_config->message_size * (size_t)gso_segments > UDP_MAXIMUM_PAYLOAD)
+    {
+        gso_segments--;
+    }
+
+    pthread_t *client_thread_array = (pthread_t *)calloc((size_t)client_config->thread_count, sizeof(pthread_t));
+    udp_client_thread_context_t *thread_context_array = (udp_client_thread_context_t *)calloc((size_t)client_config->thread_count, sizeof(udp_client_thread_context_t));
+    if (!client_thread_array || !thread_context_array)
+    {
+        free(client_thread_array);
+        free(thread_context_array);
+        return 1;
+    }
+    for (int thread_index = 0; thread_index < client_config->thread_count; thread_index++)
+    {
+        thread_context_array[thread_index].thread_index = thread_index;
+        thread_context_array[thread_index].client_config = client_config;
+        thread_context_array[thread_index].send_operation_mode = send_operation_mode;
+        thread_context_array[thread_index].gso_segments = gso_segments;
+        pthread_create(&client_thread_array[thread_index], NULL, udp_client_thread_main, &thread_context_array[thread_index]);
+    }
+
+    uint64_t aggregated_sent_count = 0;
+    uint64_t aggregated_received_count = 0;
+    uint64_t aggregated_reordered_count = 0;
+    uint64_t aggregated_syscall_count = 0;
+    uint64_t maximum_elapsed_nanoseconds = 0;
+    int reported_thread_count = 0;
+    int zerocopy_thread_count = 0;
+    int zerocopy_stalled_thread_count = 0;
+    for (int thread_index = 0; thread_index < client_config->thread_count; thread_index++)
+    {
+        udp_client_thread_context_t *thread_context = &thread_context_array[thread_index];
+        pthread_join(client_thread_array[thread_index], NULL);
+        aggregated_sent_count += thread_context->sent_datagram_count;
+        aggregated_received_count += thread_context->report_received ? thread_context->received_count : 0;
+        aggregated_reordered_count += thread_context->reordered_count;
+        aggregated_syscall_count += thread_context->send_syscall_count;
+        reported_thread_count += thread_context->report_received;
+        zerocopy_thread_count += thread_context->zerocopy_enabled;
+        zerocopy_stalled_thread_count += thread_context->zerocopy_pending_count > 0;
+        if (thread_context->elapsed_nanoseconds > maximum_elapsed_nanoseconds)
+        {
+            maximum_elapsed_nanoseconds = thread_context->elapsed_nanoseconds;
+        }
+        gso_segments = thread_context->gso_segments < gso_segments ? thread_context->gso_segments : gso_segments;
+    }
+
+    uint64_t lost_count = aggregated_sent_count > aggregated_received_count ? aggregated_sent_count - aggregated_received_count : 0;
+    double elapsed_time_seconds = (double)maximum_elapsed_nanoseconds / 1e9;
+    report_result(MODE_THROUGHPUT, aggregated_received_count * client_config->message_size, aggregated_received_count, 0, maximum_elapsed_nanoseconds);
+    printf("UDP,%d,%d,%d,%d,%llu,%llu,%llu,%.4f,%llu,%.6f,%.2f,%d\n",
+           client_config->thread_count,
+           gso_segments,
+           client_config->send_batch_size,
+           zerocopy_thread_count == client_config->thread_count ? 1 : 0,
+           (unsigned long long)aggregated_sent_count,
+           (unsigned long long)aggregated_received_count,
+           (unsigned long long)lost_count,
+           aggregated_sent_count ? 100.0 * (double)lost_count / (double)aggregated_sent_count : 0.0,
+           (unsigned long long)aggregated_reordered_count,
+           elapsed_time_seconds > 0.0 ? (double)aggregated_sent_count * (double)client_config->message_size * 8.0 / (elapsed_time_seconds * 1e9) : 0.0,
+           aggregated_syscall_count ? (double)aggregated_sent_count / (double)aggregated_syscall_count : 0.0,
+           reported_thread_count);
+
+    free(client_thread_array);
+    free(thread_context_array);
+    return reported_thread_count == client_config->thread_count && zerocopy_stalled_thread_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,582 @@
+#include "MT25041_Part_Common.h"
+#include "MT25041_Part_Ring.h"
+
+#include <poll.h>
+#include <sys/eventfd.h>
+
+#define WORK_DEQUE_CAPACITY 4096
+#define WORK_IDLE_WAIT_NANOSECONDS 200000L
+
+typedef struct server_work_connection server_work_connection_t;
+
+typedef struct server_work_task
+{
+    struct server_work_task *next_task;
+    server_work_connection_t *connection_ptr;
+    char *payload_buffer;
+    uint64_t received_time_ns;
+} server_work_task_t;
+
+struct server_work_connection
+{
+    pthread_mutex_t completion_mutex;
+    server_work_task_t *completed_task_list;
+    int completion_event_fd;
+};
+
+typedef struct
+{
+    _Alignas(CACHE_LINE_SIZE) atomic_long top_index;
+    _Alignas(CACHE_LINE_SIZE) atomic_long bottom_index;
+    _Alignas(CACHE_LINE_SIZE) long capacity_mask;
+    _Atomic(server_work_task_t *) *task_array;
+} work_stealing_deque_t;
+
+typedef struct
+{
+    server_work_pool_t *work_pool_ptr;
+    int worker_index;
+    pthread_t worker_thread;
+    work_stealing_deque_t local_deque;
+    pthread_mutex_t inbox_mutex;
+    pthread_cond_t inbox_condition;
+    server_work_task_t *inbox_task_list;
+    server_work_scratch_t work_scratch;
+    uint64_t executed_tasks;
+    uint64_t stolen_tasks;
+    uint64_t completion_flushes;
+} work_pool_worker_t;
+
+struct server_work_pool
+{
+    const server_config_t *server_config;
+    int worker_count;
+    work_pool_worker_t *worker_array;
+    atomic_int shutdown_requested;
+    atomic_uint next_worker_index;
+};
+
+const char *server_work_kind_name(enum server_work_kind work_kind)
+{
+    switch (work_kind)
+    {
+    case WORK_NONE:
+        return "none";
+    case WORK_SPIN:
+        return "spin";
+    case WORK_TOUCH:
+        return "touch";
+    case WORK_HASH:
+        return "hash";
+    case WORK_SORT:
+        return "sort";
+    }
+    return "unknown";
+}
+
+int server_work_parse_kind(const char *kind_string, enum server_work_kind *work_kind_ptr)
+{
+    for (int kind_index = WORK_NONE; kind_index <= WORK_SORT; kind_index++)
+    {
+        if (strcmp(kind_string, server_work_kind_name((enum server_work_kind)kind_index)) == 0)
+        {
+            *work_kind_ptr = (enum server_work_kind)kind_index;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int server_work_scratch_init(server_work_scratch_t *scratch_ptr, const server_config_t *server_config)
+{
+    memset(scratch_ptr, 0, sizeof(*scratch_ptr));
+    if (server_config->work_kind == WORK_TOUCH && server_config->work_working_set_bytes > 0)
+    {
+        scratch_ptr->working_set_bytes = server_config->work_working_set_bytes;
+        scratch_ptr->working_set_buffer = (char *)calloc(1, scratch_ptr->working_set_bytes);
+        if (!scratch_ptr->working_set_buffer)
+        {
+            return -1;
+        }
+    }
+    if (server_config->work_kind == WORK_SORT)
+    {
+        scratch_ptr->sort_capacity = server_config->message_size / sizeof(uint32_t);
+        scratch_ptr->sort_buffer = (uint32_t *)malloc((scratch_ptr->sort_capacity + 1) * sizeof(uint32_t));
+        if (!scratch_ptr->sort_buffer)
+        {
+            free(scratch_ptr->working_set_buffer);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void server_work_scratch_free(server_work_scratch_t *scratch_ptr)
+{
+    free(scratch_ptr->working_set_buffer);
+    free(scratch_ptr->sort_buffer);
+    memset(scratch_ptr, 0, sizeof(*scratch_ptr));
+}
+
+static int compare_uint32(const void *left_pointer, const void *right_pointer)
+{
+    uint32_t left_value = *(const uint32_t *)left_pointer;
+    uint32_t right_value = *(const uint32_t *)right_pointer;
+    return (left_value > right_value) - (left_value < right_value);
+}
+
+void server_work_execute(const server_config_t *server_config, server_work_scratch_t *scratch_ptr, const char *payload_buffer, size_t payload_length)
+{
+    if (server_config->work_kind == WORK_SPIN)
+    {
+        uint64_t spin_start_time_ns = now_ns();
+        while (now_ns() - spin_start_time_ns < server_config->work_nanoseconds)
+        {
+        }
+    }
+    else if (server_config->work_kind == WORK_TOUCH)
+    {
+        volatile char *working_set_pointer = scratch_ptr->working_set_buffer;
+        for (size_t line_offset = 0; line_offset < scratch_ptr->working_set_bytes; line_offset += CACHE_LINE_SIZE)
+        {
+            working_set_pointer[line_offset]++;
+        }
+        scratch_ptr->result_sink += (uint64_t)(uint8_t)working_set_pointer[0];
+    }
+    else if (server_config->work_kind == WORK_HASH)
+    {
+        uint64_t running_hash = 14695981039346656037ULL;
+        for (size_t byte_index = 0; byte_index < payload_length; byte_index++)
+        {
+            running_hash ^= (uint8_t)payload_buffer[byte_index];
+            running_hash *= 1099511628211ULL;
+        }
+        scratch_ptr->result_sink ^= running_hash;
+    }
+    else if (server_config->work_kind == WORK_SORT)
+    {
+        size_t word_count = payload_length / sizeof(uint32_t);
+        if (word_count > scratch_ptr->sort_capacity)
+        {
+            word_count = scratch_ptr->sort_capacity;
+        }
+        memcpy(scratch_ptr->sort_buffer, payload_buffer, word_count * sizeof(uint32_t));
+        for (size_t word_index = 0; word_index < word_count; word_index++)
+        {
+            scratch_ptr->sort_buffer[word_index] ^= (uint32_t)(word_index * 2654435761u);
+        }
+        qsort(scratch_ptr->sort_buffer, word_count, sizeof(uint32_t), compare_uint32);
+        scratch_ptr->result_sink += word_count ? scratch_ptr->sort_buffer[0] : 0;
+    }
+}
+
+static int work_deque_init(work_stealing_deque_t *deque_ptr, long deque_capacity)
+{
+    deque_ptr->task_array = calloc((size_t)deque_capacity, sizeof(*deque_ptr->task_array));
+    if (!deque_ptr->task_array)
+    {
+        return -1;
+    }
+    deque_ptr->capacity_mask = deque_capacity - 1;
+    atomic_init(&deque_ptr->top_index, 0);
+    atomic_init(&deque_ptr->bottom_index, 0);
+    return 0;
+}
+
+static int work_deque_push(work_stealing_deque_t *deque_ptr, server_work_task_t *task_ptr)
+{
+    long bottom_index = atomic_load_explicit(&deque_ptr->bottom_index, memory_order_relaxed);
+    long top_index = atomic_load_explicit(&deque_ptr->top_index, memory_order_acquire);
+    if (bottom_index - top_index > deque_ptr->capacity_mask)
+    {
+        return 0;
+    }
+    atomic_store_explicit(&deque_ptr->task_array[bottom_index & deque_ptr->capacity_mask], task_ptr, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque_ptr->bottom_index, bottom_index + 1, memory_order_relaxed);
+    return 1;
+}
+
+static server_work_task_t *work_deque_pop(work_stealing_deque_t *deque_ptr)
+{
+    long bottom_index = atomic_load_explicit(&deque_ptr->bottom_index, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque_ptr->bottom_index, bottom_index, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long top_index = atomic_load_explicit(&deque_ptr->top_index, memory_order_relaxed);
+    if (top_index > bottom_index)
+    {
+        atomic_store_explicit(&deque_ptr->bottom_index, bottom_index + 1, memory_order_relaxed);
+        return NULL;
+    }
+    server_work_task_t *task_ptr = atomic_load_explicit(&deque_ptr->task_array[bottom_index & deque_ptr->capacity_mask], memory_order_relaxed);
+    if (top_index == bottom_index)
+    {
+        if (!atomic_compare_exchange_strong_explicit(&deque_ptr->top_index, &top_index, top_index + 1, memory_order_seq_cst, memory_order_relaxed))
+        {
+            task_ptr = NULL;
+        }
+        atomic_store_explicit(&deque_ptr->bottom_index, bottom_index + 1, memory_order_relaxed);
+    }
+    return task_ptr;
+}
+
+static server_work_task_t *work_deque_steal(work_stealing_deque_t *deque_ptr)
+{
+    long top_index = atomic_load_explicit(&deque_ptr->top_index, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long bottom_index = atomic_load_explicit(&deque_ptr->bottom_index, memory_order_acquire);
+    if (top_index >= bottom_index)
+    {
+        return NULL;
+    }
+    server_work_task_t *task_ptr = atomic_load_explicit(&deque_ptr->task_array[top_index & deque_ptr->capacity_mask], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque_ptr->top_index, &top_index, top_index + 1, memory_order_seq_cst, memory_order_relaxed))
+    {
+        return NULL;
+    }
+    return task_ptr;
+}
+
+static void work_worker_drain_inbox(work_pool_worker_t *worker_ptr)
+{
+    pthread_mutex_lock(&worker_ptr->inbox_mutex);
+    server_work_task_t *inbox_task_list = worker_ptr->inbox_task_list;
+    worker_ptr->inbox_task_list = NULL;
+    pthread_mutex_unlock(&worker_ptr->inbox_mutex);
+
+    while (inbox_task_list)
+    {
+        server_work_task_t *next_task_ptr = inbox_task_list->next_task;
+        if (!work_deque_push(&worker_ptr->local_deque, inbox_task_list))
+        {
+            break;
+        }
+        inbox_task_list = next_task_ptr;
+    }
+    if (inbox_task_list)
+    {
+        pthread_mutex_lock(&worker_ptr->inbox_mutex);
+        server_work_task_t *tail_task_ptr = inbox_task_list;
+        while (tail_task_ptr->next_task)
+        {
+            tail_task_ptr = tail_task_ptr->next_task;
+        }
+        tail_task_ptr->next_task = worker_ptr->inbox_task_list;
+        worker_ptr->inbox_task_list = inbox_task_list;
+        pthread_mutex_unlock(&worker_ptr->inbox_mutex);
+    }
+}
+
+static void work_worker_flush_completions(work_pool_worker_t *worker_ptr, server_work_task_t **completed_task_array, int completed_task_count)
+{
+    for (int task_index = 0; task_index < completed_task_count; task_index++)
+    {
+        if (!completed_task_array[task_index])
+        {
+            continue;
+        }
+        server_work_connection_t *connection_ptr = completed_task_array[task_index]->connection_ptr;
+        pthread_mutex_lock(&connection_ptr->completion_mutex);
+        for (int matching_index = task_index; matching_index < completed_task_count; matching_index++)
+        {
+            server_work_task_t *task_ptr = completed_task_array[matching_index];
+            if (task_ptr && task_ptr->connection_ptr == connection_ptr)
+            {
+                task_ptr->next_task = connection_ptr->completed_task_list;
+                connection_ptr->completed_task_list = task_ptr;
+                completed_task_array[matching_index] = NULL;
+            }
+        }
+        uint64_t completion_signal = 1;
+        if (write(connection_ptr->completion_event_fd, &completion_signal, sizeof(completion_signal)) < 0)
+        {
+            perror("eventfd write");
+        }
+        pthread_mutex_unlock(&connection_ptr->completion_mutex);
+    }
+    worker_ptr->completion_flushes++;
+}
+
+static void *work_worker_main(void *thread_argument)
+{
+    work_pool_worker_t *worker_ptr = (work_pool_worker_t *)thread_argument;
+    server_work_pool_t *work_pool_ptr = worker_ptr->work_pool_ptr;
+    const server_config_t *server_config = work_pool_ptr->server_config;
+    int completion_batch_size = server_config->work_completion_batch;
+    server_work_task_t *completed_task_array[completion_batch_size];
+    int completed_task_count = 0;
+
+    if (server_config->cpu_pin_base >= 0)
+    {
+        pin_thread(server_config->cpu_pin_base + server_config->maximum_clients + worker_ptr->worker_index);
+    }
+
+    while (1)
+    {
+        work_worker_drain_inbox(worker_ptr);
+        server_work_task_t *task_ptr = work_deque_pop(&worker_ptr->local_deque);
+        for (int victim_offset = 1; !task_ptr && victim_offset < work_pool_ptr->worker_count; victim_offset++)
+        {
+            work_pool_worker_t *victim_ptr = &work_pool_ptr->worker_array[(worker_ptr->worker_index + victim_offset) % work_pool_ptr->worker_count];
+            task_ptr = work_deque_steal(&victim_ptr->local_deque);
+            if (task_ptr)
+            {
+                worker_ptr->stolen_tasks++;
+            }
+        }
+
+        if (task_ptr)
+        {
+            server_work_execute(server_config, &worker_ptr->work_scratch, task_ptr->payload_buffer, server_config->message_size);
+            worker_ptr->executed_tasks++;
+            completed_task_array[completed_task_count++] = task_ptr;
+            if (completed_task_count == completion_batch_size)
+            {
+                work_worker_flush_completions(worker_ptr, completed_task_array, completed_task_count);
+                completed_task_count = 0;
+            }
+            continue;
+        }
+
+        if (completed_task_count > 0)
+        {
+            work_worker_flush_completions(worker_ptr, completed_task_array, completed_task_count);
+            completed_task_count = 0;
+            continue;
+        }
+        if (atomic_load_explicit(&work_pool_ptr->shutdown_requested, memory_order_acquire))
+        {
+            break;
+        }
+
+        pthread_mutex_lock(&worker_ptr->inbox_mutex);
+        if (!worker_ptr->inbox_task_list && !atomic_load_explicit(&work_pool_ptr->shutdown_requested, memory_order_acquire))
+        {
+            struct timespec wait_deadline;
+            clock_gettime(CLOCK_REALTIME, &wait_deadline);
+            wait_deadline.tv_nsec += WORK_IDLE_WAIT_NANOSECONDS;
+            if (wait_deadline.tv_nsec >= 1000000000L)
+            {
+                wait_deadline.tv_sec++;
+                wait_deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&worker_ptr->inbox_condition, &worker_ptr->inbox_mutex, &wait_deadline);
+        }
+        pthread_mutex_unlock(&worker_ptr->inbox_mutex);
+    }
+    return NULL;
+}
+
+server_work_pool_t *server_work_pool_create(const server_config_t *server_config)
+{
+    server_work_pool_t *work_pool_ptr = (server_work_pool_t *)calloc(1, sizeof(server_work_pool_t));
+    if (!work_pool_ptr)
+    {
+        return NULL;
+    }
+    work_pool_ptr->server_config = server_config;
+    work_pool_ptr->worker_count = server_config->work_pool_threads;
+    atomic_init(&work_pool_ptr->shutdown_requested, 0);
+    atomic_init(&work_pool_ptr->next_worker_index, 0);
+    work_pool_ptr->worker_array = (work_pool_worker_t *)aligned_alloc(CACHE_LINE_SIZE, sizeof(work_pool_worker_t) * (size_t)work_pool_ptr->worker_count);
+    if (!work_pool_ptr->worker_array)
+    {
+        free(work_pool_ptr);
+        return NULL;
+    }
+    memset(work_pool_ptr->worker_array, 0, sizeof(work_pool_worker_t) * (size_t)work_pool_ptr->worker_count);
+
+    for (int worker_index = 0; worker_index < work_pool_ptr->worker_count; worker_index++)
+    {
+        work_pool_worker_t *worker_ptr = &work_pool_ptr->worker_array[worker_index];
+        worker_ptr->work_pool_ptr = work_pool_ptr;
+        worker_ptr->worker_index = worker_index;
+        pthread_mutex_init(&worker_ptr->inbox_mutex, NULL);
+        pthread_cond_init(&worker_ptr->inbox_condition, NULL);
+        if (work_deque_init(&worker_ptr->local_deque, WORK_DEQUE_CAPACITY) != 0 ||
+            server_work_scratch_init(&worker_ptr->work_scratch, server_config) != 0)
+        {
+            for (int cleanup_index = 0; cleanup_index <= worker_index; cleanup_index++)
+            {
+                work_pool_worker_t *cleanup_worker_ptr = &work_pool_ptr->worker_array[cleanup_index];
+                free(cleanup_worker_ptr->local_deque.task_array);
+                server_work_scratch_free(&cleanup_worker_ptr->work_scratch);
+                pthread_mutex_destroy(&cleanup_worker_ptr->inbox_mutex);
+                pthread_cond_destroy(&cleanup_worker_ptr->inbox_condition);
+            }
+            free(work_pool_ptr->worker_array);
+            free(work_pool_ptr);
+            return NULL;
+        }
+    }
+    for (int worker_index = 0; worker_index < work_pool_ptr->worker_count; worker_index++)
+    {
+        pthread_create(&work_pool_ptr->worker_array[worker_index].worker_thread, NULL, work_worker_main, &work_pool_ptr->worker_array[worker_index]);
+    }
+    return work_pool_ptr;
+}
+
+void server_work_pool_destroy(server_work_pool_t *work_pool_ptr)
+{
+    if (!work_pool_ptr)
+    {
+        return;
+    }
+    atomic_store_explicit(&work_pool_ptr->shutdown_requested, 1, memory_order_release);
+    uint64_t executed_tasks_total = 0;
+    uint64_t stolen_tasks_total = 0;
+    uint64_t completion_flushes_total = 0;
+
+    for (int worker_index = 0; worker_index < work_pool_ptr->worker_count; worker_index++)
+    {
+        work_pool_worker_t *worker_ptr = &work_pool_ptr->worker_array[worker_index];
+        pthread_mutex_lock(&worker_ptr->inbox_mutex);
+        pthread_cond_signal(&worker_ptr->inbox_condition);
+        pthread_mutex_unlock(&worker_ptr->inbox_mutex);
+        pthread_join(worker_ptr->worker_thread, NULL);
+        executed_tasks_total += worker_ptr->executed_tasks;
+        stolen_tasks_total += worker_ptr->stolen_tasks;
+        completion_flushes_total += worker_ptr->completion_flushes;
+        free(worker_ptr->local_deque.task_array);
+        server_work_scratch_free(&worker_ptr->work_scratch);
+        pthread_mutex_destroy(&worker_ptr->inbox_mutex);
+        pthread_cond_destroy(&worker_ptr->inbox_condition);
+    }
+
+    printf("SERVER_POOL,%d,%llu,%llu,%llu,%.2f\n",
+           work_pool_ptr->worker_count,
+           (unsigned long long)executed_tasks_total,
+           (unsigned long long)stolen_tasks_total,
+           (unsigned long long)completion_flushes_total,
+           completion_flushes_total ? (double)executed_tasks_total / (double)completion_flushes_total : 0.0);
+
+    free(work_pool_ptr->worker_array);
+    free(work_pool_ptr);
+}
+
+static void work_pool_submit(work_pool_worker_t *worker_ptr, server_work_task_t *task_ptr)
+{
+    pthread_mutex_lock(&worker_ptr->inbox_mutex);
+    task_ptr->next_task = worker_ptr->inbox_task_list;
+    worker_ptr->inbox_task_list = task_ptr;
+    pthread_cond_signal(&worker_ptr->inbox_condition);
+    pthread_mutex_unlock(&worker_ptr->inbox_mutex);
+}
+
+int server_work_serve_connection(server_work_pool_t *work_pool_ptr, const server_config_t *server_config, int socket_file_descriptor, latency_histogram_t *service_histogram_ptr, uint64_t *received_bytes_ptr)
+{
+    server_work_connection_t connection_state;
+    pthread_mutex_init(&connection_state.completion_mutex, NULL);
+    connection_state.completed_task_list = NULL;
+    connection_state.completion_event_fd = eventfd(0, EFD_CLOEXEC);
+    int task_count = server_config->work_inflight_limit;
+    server_work_task_t *task_array = (server_work_task_t *)calloc((size_t)task_count, sizeof(server_work_task_t));
+    char *payload_arena = (char *)malloc(server_config->message_size * (size_t)task_count);
+    if (connection_state.completion_event_fd < 0 || !task_array || !payload_arena)
+    {
+        if (connection_state.completion_event_fd >= 0)
+        {
+            close(connection_state.completion_event_fd);
+        }
+        free(task_array);
+        free(payload_arena);
+        pthread_mutex_destroy(&connection_state.completion_mutex);
+        return -1;
+    }
+
+    server_work_task_t *free_task_list = NULL;
+    for (int task_index = 0; task_index < task_count; task_index++)
+    {
+        task_array[task_index].connection_ptr = &connection_state;
+        task_array[task_index].payload_buffer = payload_arena + server_config->message_size * (size_t)task_index;
+        task_array[task_index].next_task = free_task_list;
+        free_task_list = &task_array[task_index];
+    }
+
+    unsigned home_worker_index = atomic_fetch_add_explicit(&work_pool_ptr->next_worker_index, 1, memory_order_relaxed) % (unsigned)work_pool_ptr->worker_count;
+    work_pool_worker_t *home_worker_ptr = &work_pool_ptr->worker_array[home_worker_index];
+    int peer_open = 1;
+    int inflight_task_count = 0;
+    uint64_t received_byte_count = 0;
+
+    while (peer_open || inflight_task_count > 0)
+    {
+        struct pollfd poll_descriptors[2];
+        poll_descriptors[0].fd = connection_state.completion_event_fd;
+        poll_descriptors[0].events = POLLIN;
+        poll_descriptors[0].revents = 0;
+        nfds_t poll_descriptor_count = 1;
+        if (peer_open && free_task_list)
+        {
+            poll_descriptors[1].fd = socket_file_descriptor;
+            poll_descriptors[1].events = POLLIN;
+            poll_descriptors[1].revents = 0;
+            poll_descriptor_count = 2;
+        }
+        if (poll(poll_descriptors, poll_descriptor_count, -1) < 0)
+        {
+            if (errno == EINTR || inflight_task_count > 0)
+            {
+                continue;
+            }
+            break;
+        }
+
+        if (poll_descriptors[0].revents & POLLIN)
+        {
+            uint64_t completion_signal_count = 0;
+            if (read(connection_state.completion_event_fd, &completion_signal_count, sizeof(completion_signal_count)) < 0 && errno != EINTR)
+            {
+                perror("eventfd read");
+            }
+            pthread_mutex_lock(&connection_state.completion_mutex);
+            server_work_task_t *completed_task_list = connection_state.completed_task_list;
+            connection_state.completed_task_list = NULL;
+            pthread_mutex_unlock(&connection_state.completion_mutex);
+
+            while (completed_task_list)
+            {
+                server_work_task_t *task_ptr = completed_task_list;
+                completed_task_list = task_ptr->next_task;
+                if (server_config->enable_echo && peer_open)
+                {
+                    if (write_full(socket_file_descriptor, task_ptr->payload_buffer, server_config->message_size) <= 0)
+                    {
+                        peer_open = 0;
+                    }
+                }
+                latency_histogram_record(service_histogram_ptr, now_ns() - task_ptr->received_time_ns);
+                task_ptr->next_task = free_task_list;
+                free_task_list = task_ptr;
+                inflight_task_count--;
+            }
+        }
+
+        if (poll_descriptor_count == 2 && (poll_descriptors[1].revents & (POLLIN | POLLHUP | POLLERR)) && peer_open && free_task_list)
+        {
+            server_work_task_t *task_ptr = free_task_list;
+            free_task_list = task_ptr->next_task;
+            if (read_full(socket_file_descriptor, task_ptr->payload_buffer, server_config->message_size) <= 0)
+            {
+                peer_open = 0;
+                task_ptr->next_task = free_task_list;
+                free_task_list = task_ptr;
+                continue;
+            }
+            received_byte_count += server_config->message_size;
+            __atomic_store_n(received_bytes_ptr, received_byte_count, __ATOMIC_RELAXED);
+            task_ptr->received_time_ns = now_ns();
+            inflight_task_count++;
+            work_pool_submit(home_worker_ptr, task_ptr);
+        }
+    }
+
+    pthread_mutex_lock(&connection_state.completion_mutex);
+    close(connection_state.completion_event_fd);
+    pthread_mutex_unlock(&connection_state.completion_mutex);
+    pthread_mutex_destroy(&connection_state.completion_mutex);
+    free(task_array);
+    free(payload_arena);
+    return 0;
+}